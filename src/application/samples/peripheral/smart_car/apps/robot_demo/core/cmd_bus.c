@@ -0,0 +1,123 @@
+/**
+ ****************************************************************************************************
+ * @file        cmd_bus.c
+ * @brief       多通道遥控命令总线实现
+ ****************************************************************************************************
+ */
+
+#include "cmd_bus.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "robot_config.h"
+#include "tcxo.h"
+
+#define CMD_BUS_READ_RETRY 4     // 读者遇到写入中的槽位时的重试次数
+#define CMD_BUS_LAT_EMA_SHIFT 3  // 延迟滑动平均系数 1/8
+
+/*
+ * 每个来源一个最新值槽位（序列锁）
+ * - 写者为该来源的接收线程 / 回调，可能被控制线程抢占在写入中途，
+ *   因此读者只做有限次重试，失败时由调用方沿用上一次读到的副本
+ * - 写者私有的 last_seq / last_rx_us 用于丢弃乱序和重复帧
+ */
+typedef struct {
+  volatile uint32_t seq;  // 槽位序号：奇数表示正在写入
+  BusCmd cmd;
+  uint8_t last_seq;     // 上一帧序号（写者私有）
+  uint64_t last_rx_us;  // 上一帧接收时间（写者私有）
+  CmdBusStats stats;    // accepted/dropped 由写者更新，其余由控制线程更新
+} CmdBusSlot;
+
+static CmdBusSlot g_slots[ROBOT_SRC_NUM];
+
+static const char* const g_source_names[ROBOT_SRC_NUM] = {
+    "local", "button", "udp", "sle", "voice"};
+
+bool cmd_bus_publish(RobotEventSource source, uint8_t seq, int8_t m1, int8_t m2,
+                     uint16_t ttl_ms) {
+  if (source >= ROBOT_SRC_NUM) return false;
+
+  CmdBusSlot* slot = &g_slots[source];
+  uint64_t now = uapi_tcxo_get_us();
+
+  // 序号不比上一帧新（8 位循环比较）且链路未中断过，视为乱序 / 重复帧
+  if (seq != CMD_BUS_SEQ_NONE && slot->last_seq != CMD_BUS_SEQ_NONE &&
+      now - slot->last_rx_us < CMD_BUS_SEQ_RESYNC_MS * 1000ULL &&
+      (int8_t)(uint8_t)(seq - slot->last_seq) <= 0) {
+    slot->stats.dropped++;
+    return false;
+  }
+  slot->last_seq = seq;
+  slot->last_rx_us = now;
+
+  slot->seq++;  // 奇数：写入中
+  ROBOT_MEMORY_BARRIER();
+  slot->cmd.rx_us = now;
+  slot->cmd.ttl_ms = ttl_ms;
+  slot->cmd.source = (uint8_t)source;
+  slot->cmd.seq = seq;
+  slot->cmd.m1 = m1;
+  slot->cmd.m2 = m2;
+  ROBOT_MEMORY_BARRIER();
+  slot->seq++;  // 偶数：写入完成
+  slot->stats.accepted++;
+  return true;
+}
+
+bool cmd_bus_read(RobotEventSource source, BusCmd* out) {
+  if (source >= ROBOT_SRC_NUM || out == NULL) return false;
+
+  const CmdBusSlot* slot = &g_slots[source];
+  for (int i = 0; i < CMD_BUS_READ_RETRY; i++) {
+    uint32_t seq = slot->seq;
+    ROBOT_MEMORY_BARRIER();
+    if (seq & 1u) continue;
+    BusCmd copy = slot->cmd;
+    ROBOT_MEMORY_BARRIER();
+    if (slot->seq != seq) continue;
+    if (copy.rx_us == 0) return false;  // 从未收到命令
+    *out = copy;
+    return true;
+  }
+  return false;
+}
+
+bool cmd_bus_is_valid(const BusCmd* cmd, uint64_t now_us) {
+  if (cmd == NULL || cmd->rx_us == 0) return false;
+  return now_us - cmd->rx_us < (uint64_t)cmd->ttl_ms * 1000ULL;
+}
+
+void cmd_bus_mark_actuated(const BusCmd* cmd, uint64_t now_us) {
+  if (cmd == NULL || cmd->source >= ROBOT_SRC_NUM) return;
+
+  CmdBusStats* st = &g_slots[cmd->source].stats;
+  uint32_t lat = (uint32_t)(now_us - cmd->rx_us);
+  st->actuated++;
+  st->latency_last_us = lat;
+  if (lat > st->latency_max_us) st->latency_max_us = lat;
+  if (st->actuated == 1)
+    st->latency_avg_us = lat;
+  else
+    st->latency_avg_us = st->latency_avg_us -
+                         (st->latency_avg_us >> CMD_BUS_LAT_EMA_SHIFT) +
+                         (lat >> CMD_BUS_LAT_EMA_SHIFT);
+}
+
+void cmd_bus_get_stats(RobotEventSource source, CmdBusStats* out) {
+  if (source >= ROBOT_SRC_NUM || out == NULL) return;
+  *out = g_slots[source].stats;
+}
+
+void cmd_bus_dump_stats(void) {
+  for (int i = 0; i < ROBOT_SRC_NUM; i++) {
+    const CmdBusStats* st = &g_slots[i].stats;
+    if (st->accepted == 0 && st->dropped == 0) continue;
+    printf("[CmdBus] %-6s 接收:%u 丢弃:%u 执行:%u 延迟(us) 最近:%u 平均:%u "
+           "最大:%u\r\n",
+           g_source_names[i], (unsigned)st->accepted, (unsigned)st->dropped,
+           (unsigned)st->actuated, (unsigned)st->latency_last_us,
+           (unsigned)st->latency_avg_us, (unsigned)st->latency_max_us);
+  }
+}
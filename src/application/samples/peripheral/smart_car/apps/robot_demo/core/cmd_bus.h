@@ -0,0 +1,79 @@
+/**
+ ****************************************************************************************************
+ * @file        cmd_bus.h
+ * @brief       多通道遥控命令总线
+ * @details     UDP / SLE / 语音各自向本来源的"最新值槽位"发布电机命令，
+ *              命令带帧序号、接收时间戳和有效期 (TTL)。遥控模式按优先级
+ *              选取仍在有效期内的命令执行，并统计每个来源从接收到执行的延迟。
+ *              每个来源只有一个写者，槽位为无锁序列锁，写者从不等待读者。
+ ****************************************************************************************************
+ */
+
+#ifndef CMD_BUS_H
+#define CMD_BUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "robot_event.h"
+
+#define CMD_BUS_SEQ_NONE 0          // 帧不带序号（旧版客户端），不做乱序检查
+#define CMD_BUS_DEFAULT_TTL_MS 500  // UDP / SLE 命令有效期（信号丢失保护）
+#define CMD_BUS_SEQ_RESYNC_MS 1000  // 超过该时间无新帧时接受任意序号
+
+/**
+ * @brief 总线上的一条电机命令
+ */
+typedef struct {
+  uint64_t rx_us;   // 接收时间戳 (TCXO us)，0 表示该来源从未收到命令
+  uint16_t ttl_ms;  // 有效期，超过 rx_us + ttl 后视为失效
+  uint8_t source;   // RobotEventSource
+  uint8_t seq;      // 帧序号（8 位循环），CMD_BUS_SEQ_NONE 表示无序号
+  int8_t m1;        // 左轮 (-100 ~ 100)
+  int8_t m2;        // 右轮 (-100 ~ 100)
+} BusCmd;
+
+/**
+ * @brief 单个来源的统计
+ */
+typedef struct {
+  uint32_t accepted;         // 已发布的命令数
+  uint32_t dropped;          // 因乱序 / 重复被丢弃的帧数
+  uint32_t actuated;         // 被遥控模式执行的命令数
+  uint32_t latency_last_us;  // 最近一次接收到执行的延迟
+  uint32_t latency_max_us;   // 最大延迟
+  uint32_t latency_avg_us;   // 平均延迟（指数滑动平均）
+} CmdBusStats;
+
+/**
+ * @brief 发布一条命令（每个来源只允许一个线程 / 回调调用）
+ * @param source 命令来源
+ * @param seq 帧序号，序号不比上一帧新时丢弃；CMD_BUS_SEQ_NONE 不检查
+ * @param m1 左轮
+ * @param m2 右轮
+ * @param ttl_ms 有效期
+ * @return true 已发布，false 被丢弃
+ */
+bool cmd_bus_publish(RobotEventSource source, uint8_t seq, int8_t m1, int8_t m2,
+                     uint16_t ttl_ms);
+
+/**
+ * @brief 读取某来源的最新命令（控制线程调用，不阻塞）
+ * @return true 读到一致的副本，false 从未收到命令或写者正在更新
+ */
+bool cmd_bus_read(RobotEventSource source, BusCmd* out);
+
+/**
+ * @brief 判断命令在 now_us 时刻是否仍在有效期内
+ */
+bool cmd_bus_is_valid(const BusCmd* cmd, uint64_t now_us);
+
+/**
+ * @brief 记录一条命令已执行，更新接收到执行的延迟统计（仅控制线程调用）
+ */
+void cmd_bus_mark_actuated(const BusCmd* cmd, uint64_t now_us);
+
+void cmd_bus_get_stats(RobotEventSource source, CmdBusStats* out);
+void cmd_bus_dump_stats(void);
+
+#endif /* CMD_BUS_H */
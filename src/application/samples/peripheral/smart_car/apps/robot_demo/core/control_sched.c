@@ -0,0 +1,188 @@
+/**
+ ****************************************************************************************************
+ * @file        control_sched.c
+ * @brief       硬件定时器驱动的固定频率控制调度器实现
+ * @details     定时器回调按绝对截止时间重新装载（而不是"执行完再睡 N ms"），
+ *              因此周期不会随 tick 本身的耗时漂移；回调只释放信号量，
+ *              所有业务逻辑都在控制任务中执行。
+ ****************************************************************************************************
+ */
+
+#include "control_sched.h"
+
+#include <stdio.h>
+
+#include "common_def.h"
+#include "robot_config.h"
+#include "securec.h"
+#include "soc_osal.h"
+#include "tcxo.h"
+#include "timer.h"
+
+// 重新装载定时器的最小提前量，低于该值视为已错过该时隙
+#define SCHED_MIN_ARM_US 50
+
+typedef struct {
+  const char* name;
+  control_sched_fn_t fn;
+  uint32_t divider;       // 每隔多少个基准周期执行一次
+  uint32_t last_release;  // 上次执行时对应的释放序号
+  ControlSchedStats stats;
+} SchedGroup;
+
+static SchedGroup g_groups[CONTROL_SCHED_MAX_GROUPS];
+static int g_group_count = 0;
+
+static timer_handle_t g_timer = NULL;
+static osal_semaphore g_tick_sem;
+static uint32_t g_base_hz = 0;
+static uint32_t g_base_period_us = 0;
+
+/* 以下变量由定时器回调写入，控制任务读取 */
+static uint64_t g_next_deadline_us = 0;         // 下一个释放时刻
+static volatile uint64_t g_release_us = 0;      // 最近一次理想释放时刻
+static volatile uint32_t g_release_seq = 0;     // 释放序号（单调递增）
+static volatile uint32_t g_skipped_slots = 0;   // 回调自身滞后跳过的时隙
+
+/**
+ * @brief 定时器回调：按绝对网格重新装载并释放控制任务
+ */
+static void sched_timer_callback(uintptr_t data) {
+  unused(data);
+  uint64_t now = uapi_tcxo_get_us();
+
+  g_release_us = g_next_deadline_us;
+  g_next_deadline_us += g_base_period_us;
+
+  // 回调严重滞后时跳过已错过的网格点，保持相位不漂移
+  while ((int64_t)(g_next_deadline_us - now) < SCHED_MIN_ARM_US) {
+    g_next_deadline_us += g_base_period_us;
+    g_skipped_slots++;
+    g_release_seq++;
+  }
+
+  (void)uapi_timer_start(g_timer, (uint32_t)(g_next_deadline_us - now),
+                         sched_timer_callback, 0);
+
+  g_release_seq++;
+  osal_sem_up(&g_tick_sem);
+}
+
+int control_sched_init(uint32_t base_hz) {
+  if (base_hz == 0 || base_hz > 1000000) return -1;
+
+  g_base_hz = base_hz;
+  g_base_period_us = 1000000 / base_hz;
+  g_group_count = 0;
+  (void)memset_s(g_groups, sizeof(g_groups), 0, sizeof(g_groups));
+
+  // 二值信号量：多次释放自动合并，丢失的时隙通过释放序号统计
+  if (osal_sem_binary_sem_init(&g_tick_sem, 0) != OSAL_SUCCESS) {
+    printf("[调度] 信号量初始化失败\r\n");
+    return -1;
+  }
+
+  if (uapi_timer_create(CONTROL_SCHED_TIMER_INDEX, &g_timer) !=
+      ERRCODE_SUCC) {
+    printf("[调度] 硬件定时器创建失败\r\n");
+    osal_sem_destroy(&g_tick_sem);
+    return -1;
+  }
+
+  printf("[调度] 基准频率 %uHz (周期 %uus)\r\n", g_base_hz, g_base_period_us);
+  return 0;
+}
+
+int control_sched_add_group(const char* name, uint32_t hz,
+                            control_sched_fn_t fn) {
+  if (fn == NULL || hz == 0 || g_base_hz == 0) return -1;
+  if (g_group_count >= CONTROL_SCHED_MAX_GROUPS) return -1;
+  if (hz > g_base_hz || (g_base_hz % hz) != 0) {
+    printf("[调度] 速率组 %s: %uHz 不能整除基准 %uHz\r\n", name, hz,
+           g_base_hz);
+    return -1;
+  }
+
+  SchedGroup* g = &g_groups[g_group_count];
+  g->name = name;
+  g->fn = fn;
+  g->divider = g_base_hz / hz;
+  g->last_release = 0;
+  g->stats.period_us = g_base_period_us * g->divider;
+
+  printf("[调度] 速率组 %s: %uHz\r\n", name, hz);
+  return g_group_count++;
+}
+
+/**
+ * @brief 执行一个速率组并更新统计
+ */
+static void sched_run_group(SchedGroup* g, uint32_t seq, uint64_t release_us,
+                            uint64_t wake_us) {
+  ControlSchedStats* st = &g->stats;
+
+  // 距离上次执行超过一个本组周期，说明错过了本组的时隙
+  if (g->last_release != 0 && (seq - g->last_release) > g->divider)
+    st->overruns++;
+  g->last_release = seq;
+
+  uint32_t jitter = (uint32_t)(wake_us - release_us);
+  st->jitter_last_us = jitter;
+  if (jitter > st->jitter_max_us) st->jitter_max_us = jitter;
+
+  uint64_t t0 = uapi_tcxo_get_us();
+  g->fn();
+  uint32_t exec = (uint32_t)(uapi_tcxo_get_us() - t0);
+
+  st->exec_last_us = exec;
+  if (exec > st->exec_max_us) st->exec_max_us = exec;
+  st->runs++;
+}
+
+void control_sched_run(void) {
+  if (g_timer == NULL) return;
+
+  g_next_deadline_us = uapi_tcxo_get_us() + g_base_period_us;
+  (void)uapi_timer_start(g_timer, g_base_period_us, sched_timer_callback, 0);
+
+  while (1) {
+    (void)osal_sem_down(&g_tick_sem);
+
+    uint64_t wake_us = uapi_tcxo_get_us();
+    uint32_t seq = g_release_seq;
+    uint64_t release_us = g_release_us;
+
+    for (int i = 0; i < g_group_count; i++) {
+      SchedGroup* g = &g_groups[i];
+      if (g->last_release == 0 || (seq - g->last_release) >= g->divider)
+        sched_run_group(g, seq, release_us, wake_us);
+    }
+  }
+}
+
+bool control_sched_get_stats(int group, ControlSchedStats* out) {
+  if (out == NULL || group < 0 || group >= g_group_count) return false;
+  *out = g_groups[group].stats;
+  return true;
+}
+
+void control_sched_reset_stats(void) {
+  for (int i = 0; i < g_group_count; i++) {
+    uint32_t period = g_groups[i].stats.period_us;
+    (void)memset_s(&g_groups[i].stats, sizeof(g_groups[i].stats), 0,
+                   sizeof(g_groups[i].stats));
+    g_groups[i].stats.period_us = period;
+  }
+  g_skipped_slots = 0;
+}
+
+void control_sched_dump_stats(void) {
+  printf("[调度] 跳过时隙=%u\r\n", g_skipped_slots);
+  for (int i = 0; i < g_group_count; i++) {
+    const ControlSchedStats* st = &g_groups[i].stats;
+    printf("[调度] %s: 周期=%uus 次数=%u 超限=%u 抖动=%u/%uus 耗时=%u/%uus\r\n",
+           g_groups[i].name, st->period_us, st->runs, st->overruns,
+           st->jitter_last_us, st->jitter_max_us, st->exec_last_us,
+           st->exec_max_us);
+  }
+}
@@ -0,0 +1,76 @@
+/**
+ ****************************************************************************************************
+ * @file        control_sched.h
+ * @brief       硬件定时器驱动的固定频率控制调度器
+ * @details     由硬件定时器按绝对时间网格释放控制任务，支持多个速率组
+ *              （如控制 200Hz / 服务 50Hz / 诊断 1Hz），并统计每组的唤醒抖动、
+ *              超限次数和最坏执行时间。
+ ****************************************************************************************************
+ */
+
+#ifndef CONTROL_SCHED_H
+#define CONTROL_SCHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CONTROL_SCHED_MAX_GROUPS 4  // 最大速率组数量
+
+typedef void (*control_sched_fn_t)(void);
+
+/**
+ * @brief 速率组运行统计
+ */
+typedef struct {
+  uint32_t period_us;       // 本组名义周期 (us)
+  uint32_t runs;            // 已执行次数
+  uint32_t overruns;        // 超限次数（错过了本组的调度时隙）
+  uint32_t jitter_last_us;  // 最近一次唤醒相对理想释放时刻的延迟
+  uint32_t jitter_max_us;   // 唤醒延迟最大值
+  uint32_t exec_last_us;    // 最近一次执行耗时
+  uint32_t exec_max_us;     // 最坏执行耗时
+} ControlSchedStats;
+
+/**
+ * @brief 初始化调度器
+ * @param base_hz 基准频率（所有速率组频率必须能整除它）
+ * @return 0 成功，-1 失败
+ * @note 使用 CONTROL_SCHED_TIMER_INDEX 指定的硬件定时器，系统启动时已完成适配
+ */
+int control_sched_init(uint32_t base_hz);
+
+/**
+ * @brief 注册速率组
+ * @param name 组名（仅用于日志）
+ * @param hz 执行频率
+ * @param fn 周期回调，在控制任务上下文中执行
+ * @return 组索引，失败返回 -1
+ */
+int control_sched_add_group(const char* name, uint32_t hz,
+                            control_sched_fn_t fn);
+
+/**
+ * @brief 启动定时器并进入调度循环（不返回）
+ * @note 必须在控制任务中调用
+ */
+void control_sched_run(void);
+
+/**
+ * @brief 获取速率组统计数据
+ * @param group 组索引
+ * @param out 输出统计
+ * @return true 成功
+ */
+bool control_sched_get_stats(int group, ControlSchedStats* out);
+
+/**
+ * @brief 清零所有统计（周期保持不变）
+ */
+void control_sched_reset_stats(void);
+
+/**
+ * @brief 打印所有速率组统计
+ */
+void control_sched_dump_stats(void);
+
+#endif /* CONTROL_SCHED_H */
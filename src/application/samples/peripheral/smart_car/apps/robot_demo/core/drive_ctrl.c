@@ -0,0 +1,150 @@
+/**
+ ****************************************************************************************************
+ * @file        drive_ctrl.c
+ * @brief       两轮速度闭环与位姿实现
+ ****************************************************************************************************
+ */
+
+#include "drive_ctrl.h"
+
+#include <stdio.h>
+
+#include "../../../drivers/encoder/bsp_encoder.h"
+#include "../../../drivers/l9110s/bsp_l9110s.h"
+#include "pid_ctrl.h"
+#include "robot_config.h"
+#include "tcxo.h"
+
+#define DRIVE_PI 3.14159265f
+#define DRIVE_DEFAULT_DT_US (1000000 / CONTROL_LOOP_HZ)  // 首拍使用的 dt
+
+static Odometry g_odo;                         /* 里程计 */
+static PidCtrl g_pid[ENCODER_WHEEL_NUM];       /* 两轮速度环 */
+static float g_target[ENCODER_WHEEL_NUM];      /* 目标速度 (mm/s) */
+static float g_speed[ENCODER_WHEEL_NUM];       /* 实测速度 (mm/s) */
+static int g_dir[ENCODER_WHEEL_NUM] = {1, 1};  /* 最近一次非零输出的方向 */
+static bool g_seen[ENCODER_WHEEL_NUM];         /* 是否收到过编码器脉冲 */
+static bool g_engaged = false;                 /* 是否由本模块驱动电机 */
+static uint64_t g_last_us = 0;                 /* 上次 tick 时刻 */
+
+/**
+ * @brief 目标速度 (mm/s) 换算为开环占空比 (%)
+ */
+static float drive_ff_percent(float mm_s) {
+  return mm_s * 100.0f / DRIVE_MAX_SPEED_MM_S;
+}
+
+/**
+ * @brief 百分比限幅并取整
+ */
+static int8_t drive_clamp_percent(float pct) {
+  if (pct > 100.0f) return 100;
+  if (pct < -100.0f) return -100;
+  return (int8_t)(pct + (pct >= 0.0f ? 0.5f : -0.5f));
+}
+
+void drive_ctrl_init(void) {
+  OdometryConfig odo_cfg = {
+      .mm_per_pulse = DRIVE_PI * WHEEL_DIAMETER_MM / ENCODER_PULSES_PER_REV,
+      .track_mm = WHEEL_TRACK_MM};
+  odometry_init(&g_odo, &odo_cfg);
+
+  PidConfig cfg = {.kp = DRIVE_KP,
+                   .ki = DRIVE_KI,
+                   .kff = 100.0f / DRIVE_MAX_SPEED_MM_S,
+                   .out_min = -100.0f,
+                   .out_max = 100.0f,
+                   .anti_windup = PID_AW_CONDITIONAL};
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++) {
+    pid_init(&g_pid[i], &cfg);
+    g_target[i] = 0.0f;
+    g_speed[i] = 0.0f;
+    g_seen[i] = false;
+  }
+
+  if (encoder_init() != 0)
+    printf("[驱动] 编码器初始化失败，速度环保持开环\r\n");
+  g_engaged = false;
+  g_last_us = 0;
+}
+
+void drive_ctrl_set_speed(float left_mm_s, float right_mm_s) {
+  g_target[0] = left_mm_s;
+  g_target[1] = right_mm_s;
+  g_engaged = true;
+}
+
+void drive_ctrl_set_percent(int8_t left_pct, int8_t right_pct) {
+  drive_ctrl_set_speed(left_pct * DRIVE_MAX_SPEED_MM_S / 100.0f,
+                       right_pct * DRIVE_MAX_SPEED_MM_S / 100.0f);
+}
+
+void drive_ctrl_stop(void) {
+  drive_ctrl_set_speed(0.0f, 0.0f);
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++) pid_reset(&g_pid[i]);
+  l9110s_set_differential(0, 0);
+}
+
+void drive_ctrl_release(void) {
+  drive_ctrl_stop();
+  g_engaged = false;
+}
+
+void drive_ctrl_tick(void) {
+  uint64_t now = uapi_tcxo_get_us();
+  uint64_t elapsed = g_last_us != 0 ? now - g_last_us : DRIVE_DEFAULT_DT_US;
+  uint32_t dt_us = elapsed > DRIVE_MAX_DT_US ? DRIVE_MAX_DT_US
+                                              : (uint32_t)elapsed;
+  g_last_us = now;
+
+  // 单通道码盘不分方向：按电机实际输出方向给脉冲定号，
+  // 反向时输出经过 0，停转瞬间沿用上一次的方向
+  int8_t out[ENCODER_WHEEL_NUM];
+  l9110s_get_output(&out[0], &out[1]);
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++)
+    if (out[i] != 0) g_dir[i] = out[i] > 0 ? 1 : -1;
+
+  EncoderSnapshot snap;
+  encoder_read(&snap);
+  odometry_update(&g_odo, snap.wheel[0].count, snap.wheel[1].count, g_dir[0],
+                  g_dir[1]);
+
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++) {
+    const EncoderWheel* w = &snap.wheel[i];
+    if (w->count != 0) g_seen[i] = true;
+    g_speed[i] = g_dir[i] * odometry_wheel_speed(&g_odo.cfg, w->period_us,
+                                                 w->last_edge_us, now);
+  }
+
+  if (!g_engaged) {
+    l9110s_tick();  // 电机由当前模式直接驱动，只推进输出斜率
+    return;
+  }
+
+  int8_t duty[ENCODER_WHEEL_NUM];
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++) {
+    if (g_target[i] == 0.0f) {
+      pid_reset(&g_pid[i]);
+      duty[i] = 0;
+    } else if (!g_seen[i]) {
+      duty[i] = drive_clamp_percent(drive_ff_percent(g_target[i]));
+    } else {
+      pid_value_t o =
+          pid_update(&g_pid[i], PID_FROM_FLOAT(g_target[i] - g_speed[i]),
+                     PID_FROM_FLOAT(g_target[i]), dt_us);
+      duty[i] = drive_clamp_percent(PID_TO_FLOAT(o));
+    }
+  }
+  l9110s_set_differential(duty[0], duty[1]);
+}
+
+void drive_ctrl_get_pose(OdometryPose* out) {
+  if (out != NULL) *out = g_odo.pose;
+}
+
+void drive_ctrl_get_wheel_speed(float* left_mm_s, float* right_mm_s) {
+  if (left_mm_s) *left_mm_s = g_speed[0];
+  if (right_mm_s) *right_mm_s = g_speed[1];
+}
+
+bool drive_ctrl_has_encoder(void) { return g_seen[0] && g_seen[1]; }
@@ -0,0 +1,72 @@
+/**
+ ****************************************************************************************************
+ * @file        drive_ctrl.h
+ * @brief       两轮速度闭环与位姿
+ * @details     模式给出每轮目标速度 (mm/s)，本模块每个控制周期读编码器、
+ *              积分里程计，并用每轮一个 PI（带目标速度前馈）算出占空比交给
+ *              l9110s_set_differential。某一轮尚未收到过编码器脉冲时该轮按
+ *              前馈开环输出，未接编码器的小车行为与原来一致。
+ ****************************************************************************************************
+ */
+
+#ifndef DRIVE_CTRL_H
+#define DRIVE_CTRL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "odometry.h"
+
+/**
+ * @brief 初始化编码器、里程计和两轮速度环
+ */
+void drive_ctrl_init(void);
+
+/**
+ * @brief 设置两轮目标速度
+ * @param left_mm_s 左轮目标速度 (mm/s)，负值后退
+ * @param right_mm_s 右轮目标速度 (mm/s)
+ * @note 只记录目标，由 drive_ctrl_tick 在本周期内生效
+ */
+void drive_ctrl_set_speed(float left_mm_s, float right_mm_s);
+
+/**
+ * @brief 按最高速度百分比设置两轮目标速度（兼容原差速命令）
+ * @param left_pct 左轮 -100 ~ 100
+ * @param right_pct 右轮 -100 ~ 100
+ */
+void drive_ctrl_set_percent(int8_t left_pct, int8_t right_pct);
+
+/**
+ * @brief 目标清零并立即停车
+ */
+void drive_ctrl_stop(void);
+
+/**
+ * @brief 停车并交出电机控制权（模式切换时调用）
+ * @note 之后直到下次 set / stop 前，drive_ctrl_tick 只更新里程计，
+ *       不覆盖直接驱动 l9110s 的输出
+ */
+void drive_ctrl_release(void);
+
+/**
+ * @brief 每个控制周期调用一次：更新里程计并输出电机占空比
+ */
+void drive_ctrl_tick(void);
+
+/**
+ * @brief 获取当前位姿
+ */
+void drive_ctrl_get_pose(OdometryPose* out);
+
+/**
+ * @brief 获取两轮实测速度 (mm/s)，带方向
+ */
+void drive_ctrl_get_wheel_speed(float* left_mm_s, float* right_mm_s);
+
+/**
+ * @brief 两轮是否都已收到过编码器脉冲（可按角度 / 距离控制运动）
+ */
+bool drive_ctrl_has_encoder(void);
+
+#endif /* DRIVE_CTRL_H */
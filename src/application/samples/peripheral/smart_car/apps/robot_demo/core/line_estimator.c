@@ -0,0 +1,98 @@
+/**
+ ****************************************************************************************************
+ * @file        line_estimator.c
+ * @brief       基于红外 ADC 模拟量的连续线位置估计实现
+ ****************************************************************************************************
+ */
+
+#include "line_estimator.h"
+
+#include <stddef.h>
+
+// 各传感器在车体横向上的位置：左 -1，中 0，右 +1
+static const int32_t g_sensor_pos[LINE_SENSOR_COUNT] = {-1, 0, 1};
+
+// 黑白差值小于该值的标定视为无效 (mV)
+#define LINE_EST_MIN_SPAN_MV 200
+
+static LineCalib g_calib = {
+    .white_mv = {LINE_EST_DEFAULT_WHITE_MV, LINE_EST_DEFAULT_WHITE_MV,
+                 LINE_EST_DEFAULT_WHITE_MV},
+    .black_mv = {LINE_EST_DEFAULT_BLACK_MV, LINE_EST_DEFAULT_BLACK_MV,
+                 LINE_EST_DEFAULT_BLACK_MV},
+};
+
+static bool g_lost = true;
+static float g_last_position = 0.0f;
+
+void line_estimator_set_calib(const LineCalib* calib) {
+  if (calib == NULL) return;
+  for (int i = 0; i < LINE_SENSOR_COUNT; i++) {
+    if (calib->black_mv[i] < calib->white_mv[i] + LINE_EST_MIN_SPAN_MV)
+      continue;
+    g_calib.white_mv[i] = calib->white_mv[i];
+    g_calib.black_mv[i] = calib->black_mv[i];
+  }
+}
+
+void line_estimator_get_calib(LineCalib* calib) {
+  if (calib != NULL) *calib = g_calib;
+}
+
+void line_estimator_reset_calib(void) {
+  for (int i = 0; i < LINE_SENSOR_COUNT; i++) {
+    g_calib.white_mv[i] = LINE_EST_DEFAULT_WHITE_MV;
+    g_calib.black_mv[i] = LINE_EST_DEFAULT_BLACK_MV;
+  }
+}
+
+void line_estimator_reset(void) {
+  g_lost = true;
+  g_last_position = 0.0f;
+}
+
+/**
+ * @brief 将电压按标定值线性映射到 0~LINE_EST_NORM_MAX
+ */
+static uint16_t line_normalize(int idx, uint32_t mv) {
+  uint32_t lo = g_calib.white_mv[idx];
+  uint32_t hi = g_calib.black_mv[idx];
+  if (mv <= lo) return 0;
+  if (mv >= hi) return LINE_EST_NORM_MAX;
+  return (uint16_t)((mv - lo) * LINE_EST_NORM_MAX / (hi - lo));
+}
+
+void line_estimator_update(const uint32_t mv[LINE_SENSOR_COUNT],
+                           LineEstimate* out) {
+  if (mv == NULL || out == NULL) return;
+
+  int32_t sum = 0;
+  int32_t weighted = 0;
+  uint16_t peak = 0;
+
+  for (int i = 0; i < LINE_SENSOR_COUNT; i++) {
+    uint16_t n = line_normalize(i, mv[i]);
+    out->norm[i] = n;
+    if (n > peak) peak = n;
+
+    // 扣除白底噪声后参与质心计算，避免白底读数把位置拉向中间
+    int32_t w = (int32_t)n - LINE_EST_NOISE_FLOOR;
+    if (w <= 0) continue;
+    sum += w;
+    weighted += w * g_sensor_pos[i];
+  }
+
+  // 带滞回的丢线判定
+  if (g_lost) {
+    if (peak >= LINE_EST_LOST_OFF) g_lost = false;
+  } else if (peak < LINE_EST_LOST_ON) {
+    g_lost = true;
+  }
+
+  if (!g_lost && sum > 0)
+    g_last_position = LINE_EST_POS_SCALE * (float)weighted / (float)sum;
+
+  out->position = g_last_position;
+  out->confidence = (float)peak / (float)LINE_EST_NORM_MAX;
+  out->lost = g_lost;
+}
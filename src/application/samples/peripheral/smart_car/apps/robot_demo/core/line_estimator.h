@@ -0,0 +1,75 @@
+/**
+ ****************************************************************************************************
+ * @file        line_estimator.h
+ * @brief       基于红外 ADC 模拟量的连续线位置估计
+ * @details     对左/中/右三路 TCRT5000 电压按各自的白/黑标定值归一化，
+ *              以加权质心求出线相对车体中心的连续位置，同时给出置信度
+ *              并带滞回地判定丢线。纯计算模块，不访问硬件。
+ ****************************************************************************************************
+ */
+
+#ifndef LINE_ESTIMATOR_H
+#define LINE_ESTIMATOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define LINE_SENSOR_COUNT 3        // 传感器数量（左、中、右）
+#define LINE_EST_NORM_MAX 1000     // 归一化满量程（黑线正上方）
+#define LINE_EST_NOISE_FLOOR 50    // 归一化后低于该值视为白底噪声
+#define LINE_EST_LOST_ON 150       // 峰值低于该值判定丢线
+#define LINE_EST_LOST_OFF 250      // 峰值高于该值恢复跟踪（滞回）
+#define LINE_EST_POS_SCALE 2.0f    // 位置量程，与离散误差表 (-2 ~ 2) 一致
+
+// 未标定时使用的默认值 (mV)：白底约 0.5V，黑线约 3V
+#define LINE_EST_DEFAULT_WHITE_MV 500
+#define LINE_EST_DEFAULT_BLACK_MV 3000
+
+/**
+ * @brief 各传感器白/黑标定值 (mV)，下标 0=左 1=中 2=右
+ */
+typedef struct {
+  uint16_t white_mv[LINE_SENSOR_COUNT];
+  uint16_t black_mv[LINE_SENSOR_COUNT];
+} LineCalib;
+
+/**
+ * @brief 一次估计结果
+ */
+typedef struct {
+  float position;    // 线位置：负值线在左，正值线在右，范围 ±LINE_EST_POS_SCALE
+  float confidence;  // 置信度 0~1（最强一路的归一化读数）
+  bool lost;         // 是否丢线（丢线时 position 保持最后一次有效值）
+  uint16_t norm[LINE_SENSOR_COUNT];  // 各路归一化读数 0~LINE_EST_NORM_MAX
+} LineEstimate;
+
+/**
+ * @brief 设置标定值
+ * @note 黑白差值过小的通道保持原标定不变
+ */
+void line_estimator_set_calib(const LineCalib* calib);
+
+/**
+ * @brief 读取当前标定值
+ */
+void line_estimator_get_calib(LineCalib* calib);
+
+/**
+ * @brief 恢复默认标定值
+ */
+void line_estimator_reset_calib(void);
+
+/**
+ * @brief 清除丢线状态和历史位置（进入循迹模式时调用）
+ */
+void line_estimator_reset(void);
+
+/**
+ * @brief 根据三路电压估计线位置
+ * @param mv 左、中、右电压 (mV)
+ * @param out 输出估计结果
+ */
+void line_estimator_update(const uint32_t mv[LINE_SENSOR_COUNT],
+                           LineEstimate* out);
+
+#endif /* LINE_ESTIMATOR_H */
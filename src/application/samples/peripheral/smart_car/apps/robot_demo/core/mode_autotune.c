@@ -0,0 +1,283 @@
+#include "mode_autotune.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "../../../drivers/tcrt5000/bsp_tcrt5000.h"
+#include "../services/storage_service.h"
+#include "drive_ctrl.h"
+#include "line_estimator.h"
+#include "pid_ctrl.h"
+#include "robot_config.h"
+#include "robot_mgr.h"
+#include "soc_osal.h"
+#include "tcxo.h"
+
+/* ================= 参数配置 ================= */
+#define AT_RELAY_H 25.0f           // 继电输出幅值（差速）
+#define AT_RELAY_EPS 0.2f          // 继电滞回（误差单位），抑制噪声抖动
+#define AT_RELAY_SKIP_CYCLES 2     // 丢弃的起振周期数
+#define AT_RELAY_CYCLES 4          // 参与统计的振荡周期数
+#define AT_RELAY_TIMEOUT_MS 8000   // 继电实验超时
+#define AT_VALIDATE_SETTLE_MS 500  // 每组候选切换后的稳定时间（不计分）
+#define AT_VALIDATE_MS 3000        // 每组候选计分时长
+#define AT_LOST_MS 300             // 连续丢线超过该时间视为失败
+#define AT_OUT_LIMIT 100.0f        // PID 输出限幅
+#define AT_D_CUTOFF_HZ 10.0f       // 微分低通截止频率
+
+/**
+ * @brief 自整定阶段
+ */
+typedef enum {
+  AT_RELAY = 0,  // 继电实验
+  AT_VALIDATE    // 候选参数试跑
+} AutotunePhase;
+
+/**
+ * @brief 候选参数（连续时间系数）
+ */
+typedef struct {
+  const char* name;
+  float kp, ki, kd;
+  float cost;  // 误差绝对值积分，越小越好
+  bool ok;     // 试跑是否完成（未丢线）
+} AutotuneCandidate;
+
+enum { AT_CAND_CURRENT = 0, AT_CAND_ZN, AT_CAND_TL, AT_CAND_NUM };
+
+static AutotunePhase g_phase = AT_RELAY;
+static AutotuneCandidate g_cand[AT_CAND_NUM];
+static int g_cand_idx = 0;
+static int16_t g_base_speed = 0;
+
+static uint64_t g_phase_start_us = 0; /* 当前阶段（或候选）开始时刻 */
+static uint64_t g_last_us = 0;        /* 上一拍时刻 */
+static uint64_t g_lost_since_us = 0;  /* 开始丢线时刻，0 表示未丢线 */
+
+/* 继电实验状态 */
+static float g_relay_out = 0.0f;
+static uint64_t g_last_rise_us = 0; /* 上次切到正向输出的时刻 */
+static int g_cycles = 0;
+static float g_err_max = 0.0f, g_err_min = 0.0f;
+static float g_period_sum_s = 0.0f, g_amp_sum = 0.0f;
+
+/* 试跑状态 */
+static PidCtrl g_pid;
+
+/**
+ * @brief 按转向输出驱动差速
+ * @note 与循迹模式一样经两轮速度闭环输出，继电实验辨识和候选试跑
+ *       面对的是循迹实际运行的对象
+ */
+static void autotune_drive(float steer) {
+  int s = (int)(steer > 0 ? steer + 0.5f : steer - 0.5f);
+  int left = g_base_speed + s;
+  int right = g_base_speed - s;
+  if (left > 100) left = 100;
+  if (left < -100) left = -100;
+  if (right > 100) right = 100;
+  if (right < -100) right = -100;
+  drive_ctrl_set_percent((int8_t)left, (int8_t)right);
+}
+
+/**
+ * @brief 结束自整定并回到待机
+ */
+static void autotune_abort(const char* reason) {
+  drive_ctrl_stop();
+  printf("[自整定] 中止：%s\r\n", reason);
+  robot_mgr_set_status(CAR_STOP_STATUS);
+}
+
+/**
+ * @brief 开始试跑第 idx 组候选
+ */
+static void autotune_start_candidate(int idx, uint64_t now_us) {
+  g_cand_idx = idx;
+  g_phase_start_us = now_us;
+
+  PidConfig cfg = {
+      .kp = g_cand[idx].kp,
+      .ki = g_cand[idx].ki,
+      .kd = g_cand[idx].kd,
+      .out_min = -AT_OUT_LIMIT,
+      .out_max = AT_OUT_LIMIT,
+      .d_cutoff_hz = AT_D_CUTOFF_HZ,
+      .anti_windup = PID_AW_CONDITIONAL,
+  };
+  pid_init(&g_pid, &cfg);
+  printf("[自整定] 试跑 %s: Kp=%.2f Ki=%.2f Kd=%.3f\r\n", g_cand[idx].name,
+         g_cand[idx].kp, g_cand[idx].ki, g_cand[idx].kd);
+}
+
+/**
+ * @brief 由 Ku/Tu 生成候选参数并进入试跑阶段
+ */
+static void autotune_make_candidates(float ku, float tu, uint64_t now_us) {
+  printf("[自整定] Ku=%.2f Tu=%.3fs\r\n", ku, tu);
+
+  // Ziegler-Nichols: Kp=0.6Ku, Ti=Tu/2, Td=Tu/8
+  float kp = 0.6f * ku;
+  g_cand[AT_CAND_ZN] = (AutotuneCandidate){
+      .name = "ZN", .kp = kp, .ki = kp / (tu / 2.0f), .kd = kp * tu / 8.0f};
+
+  // Tyreus-Luyben: Kp=Ku/2.2, Ti=2.2Tu, Td=Tu/6.3（超调更小）
+  kp = ku / 2.2f;
+  g_cand[AT_CAND_TL] = (AutotuneCandidate){
+      .name = "TL", .kp = kp, .ki = kp / (2.2f * tu), .kd = kp * tu / 6.3f};
+
+  g_phase = AT_VALIDATE;
+  autotune_start_candidate(AT_CAND_CURRENT, now_us);
+}
+
+/**
+ * @brief 继电实验一拍
+ */
+static void autotune_relay_step(float error, uint64_t now_us) {
+  if (error > g_err_max) g_err_max = error;
+  if (error < g_err_min) g_err_min = error;
+
+  if (error > AT_RELAY_EPS && g_relay_out <= 0.0f) {
+    // 切到正向输出：以此为一个振荡周期的起点
+    g_relay_out = AT_RELAY_H;
+    if (g_last_rise_us != 0) {
+      g_cycles++;
+      if (g_cycles > AT_RELAY_SKIP_CYCLES) {
+        g_period_sum_s += (float)(now_us - g_last_rise_us) / 1000000.0f;
+        g_amp_sum += (g_err_max - g_err_min) / 2.0f;
+      }
+    }
+    g_last_rise_us = now_us;
+    g_err_max = g_err_min = error;
+  } else if (error < -AT_RELAY_EPS && g_relay_out >= 0.0f) {
+    g_relay_out = -AT_RELAY_H;
+  }
+  autotune_drive(g_relay_out);
+
+  int measured = g_cycles - AT_RELAY_SKIP_CYCLES;
+  if (measured >= AT_RELAY_CYCLES) {
+    float tu = g_period_sum_s / (float)measured;
+    float a = g_amp_sum / (float)measured;
+    if (a <= AT_RELAY_EPS) {
+      autotune_abort("振荡幅值过小");
+      return;
+    }
+    // 带滞回继电的描述函数：Ku = 4h / (pi * sqrt(a^2 - eps^2))
+    float ku = 4.0f * AT_RELAY_H /
+               (3.14159265f * sqrtf(a * a - AT_RELAY_EPS * AT_RELAY_EPS));
+    autotune_make_candidates(ku, tu, now_us);
+    return;
+  }
+
+  if (now_us - g_phase_start_us > (uint64_t)AT_RELAY_TIMEOUT_MS * 1000)
+    autotune_abort("未形成稳定振荡");
+}
+
+/**
+ * @brief 选出最优候选并写入 NV（仅一次写入）
+ */
+static void autotune_commit(void) {
+  int best = -1;
+  for (int i = 0; i < AT_CAND_NUM; i++) {
+    printf("[自整定] %s: %s 代价=%.3f\r\n", g_cand[i].name,
+           g_cand[i].ok ? "完成" : "失败", g_cand[i].cost);
+    if (g_cand[i].ok && (best < 0 || g_cand[i].cost < g_cand[best].cost))
+      best = i;
+  }
+
+  drive_ctrl_stop();
+  if (best < 0) {
+    printf("[自整定] 无有效候选，保留原参数\r\n");
+  } else if (best == AT_CAND_CURRENT) {
+    printf("[自整定] 原参数最优，无需保存\r\n");
+  } else {
+    const AutotuneCandidate* c = &g_cand[best];
+    (void)storage_service_save_pid_params(c->kp, c->ki * PID_NV_DT_S,
+                                          c->kd / PID_NV_DT_S, g_base_speed);
+    printf("[自整定] 采用 %s 参数\r\n", c->name);
+  }
+  robot_mgr_set_status(CAR_STOP_STATUS);
+}
+
+/**
+ * @brief 候选试跑一拍
+ */
+static void autotune_validate_step(float error, uint32_t dt_us,
+                                   uint64_t now_us) {
+  AutotuneCandidate* c = &g_cand[g_cand_idx];
+  float out =
+      PID_TO_FLOAT(pid_update(&g_pid, PID_FROM_FLOAT(error), 0, dt_us));
+  autotune_drive(out);
+  robot_mgr_update_pid(error, out);
+  robot_mgr_update_pid_terms(PID_TO_FLOAT(g_pid.p_term),
+                             PID_TO_FLOAT(g_pid.i_term),
+                             PID_TO_FLOAT(g_pid.d_term));
+
+  uint64_t elapsed_us = now_us - g_phase_start_us;
+  if (elapsed_us > (uint64_t)AT_VALIDATE_SETTLE_MS * 1000)
+    c->cost += fabsf(error) * ((float)dt_us / 1000000.0f);
+
+  uint64_t total_us = (uint64_t)(AT_VALIDATE_SETTLE_MS + AT_VALIDATE_MS) * 1000;
+  if (elapsed_us >= total_us) {
+    c->ok = true;
+    if (g_cand_idx + 1 < AT_CAND_NUM)
+      autotune_start_candidate(g_cand_idx + 1, now_us);
+    else
+      autotune_commit();
+  }
+}
+
+void mode_autotune_enter(void) {
+  printf("进入 PID 自整定模式，请将小车放在黑线上\r\n");
+
+  float kp, ki, kd;
+  storage_service_get_pid_params(&kp, &ki, &kd, &g_base_speed);
+  g_cand[AT_CAND_CURRENT] = (AutotuneCandidate){
+      .name = "当前", .kp = kp, .ki = ki / PID_NV_DT_S, .kd = kd * PID_NV_DT_S};
+
+  g_phase = AT_RELAY;
+  g_relay_out = 0.0f;
+  g_last_rise_us = 0;
+  g_cycles = 0;
+  g_err_max = g_err_min = 0.0f;
+  g_period_sum_s = g_amp_sum = 0.0f;
+  g_lost_since_us = 0;
+  g_phase_start_us = g_last_us = uapi_tcxo_get_us();
+  line_estimator_reset();
+}
+
+void mode_autotune_tick(void) {
+  Tcrt5000SampleSet ir;
+  robot_mgr_get_ir(&ir);
+
+  LineEstimate est;
+  line_estimator_update(ir.mv, &est);
+
+  uint64_t now_us = uapi_tcxo_get_us();
+  uint32_t dt_us = (uint32_t)(now_us - g_last_us);
+  g_last_us = now_us;
+
+  // 丢线保护：短暂丢线沿用最后位置，持续丢线则结束本阶段
+  if (est.lost) {
+    if (g_lost_since_us == 0) g_lost_since_us = now_us;
+    if (now_us - g_lost_since_us > (uint64_t)AT_LOST_MS * 1000) {
+      if (g_phase == AT_RELAY) {
+        autotune_abort("继电实验中丢线");
+      } else {
+        g_cand[g_cand_idx].ok = false;  // 丢线的候选直接淘汰，后续不再试跑
+        printf("[自整定] %s 试跑丢线\r\n", g_cand[g_cand_idx].name);
+        autotune_commit();
+      }
+      return;
+    }
+  } else {
+    g_lost_since_us = 0;
+  }
+
+  if (g_phase == AT_RELAY)
+    autotune_relay_step(est.position, now_us);
+  else
+    autotune_validate_step(est.position, dt_us, now_us);
+}
+
+void mode_autotune_exit(void) { drive_ctrl_stop(); }
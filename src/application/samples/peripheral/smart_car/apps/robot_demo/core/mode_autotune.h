@@ -0,0 +1,15 @@
+#ifndef MODE_AUTOTUNE_H
+#define MODE_AUTOTUNE_H
+
+/*
+ * 循迹 PID 自整定模式（继电反馈法）：
+ * 1. 继电实验：转向输出只取 ±h，沿线形成等幅振荡，测出临界增益 Ku 与周期 Tu
+ * 2. 按 Ziegler-Nichols / Tyreus-Luyben 规则生成候选参数
+ * 3. 当前参数与候选参数依次试跑一小段，以误差绝对值积分评分
+ * 4. 仅当最优候选优于当前参数时写入一次 NV，完成后回到待机模式
+ */
+void mode_autotune_enter(void);
+void mode_autotune_tick(void);
+void mode_autotune_exit(void);
+
+#endif
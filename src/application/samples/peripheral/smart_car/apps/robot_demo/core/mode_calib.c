@@ -0,0 +1,158 @@
+#include "mode_calib.h"
+
+#include <stdio.h>
+
+#include "../services/storage_service.h"
+#include "drive_ctrl.h"
+#include "line_estimator.h"
+#include "robot_config.h"
+#include "robot_mgr.h"
+#include "securec.h"
+#include "soc_osal.h"
+
+/* ================= 参数配置 ================= */
+#define CALIB_NOISE_MS 300     // 静止采样时间（测噪声）
+#define CALIB_SPIN_MS 1500     // 每个方向原地慢转的时间
+#define CALIB_SPIN_SPEED 35    // 原地慢转速度
+#define CALIB_MIN_SPAN_MV 400  // 黑白差值下限 (mV)
+#define CALIB_MIN_SNR 4        // 黑白差值至少为噪声的倍数
+#define CALIB_HYST_MIN_MV 50   // 滞回宽度下限 (mV)
+#define CALIB_HYST_DIV 8       // 滞回宽度取黑白差值的 1/8
+
+/**
+ * @brief 标定阶段
+ */
+typedef enum {
+  CALIB_NOISE = 0,  // 静止采样
+  CALIB_SPIN_LEFT,  // 原地左转扫线
+  CALIB_SPIN_RIGHT  // 原地右转扫线（回到初始朝向附近）
+} CalibPhase;
+
+static CalibPhase g_phase = CALIB_NOISE;
+static unsigned long long g_phase_deadline = 0; /* 当前阶段到期时刻 */
+
+static uint16_t g_min_mv[TCRT5000_CHANNEL_NUM];   /* 扫线最小值 */
+static uint16_t g_max_mv[TCRT5000_CHANNEL_NUM];   /* 扫线最大值 */
+static uint16_t g_still_lo[TCRT5000_CHANNEL_NUM]; /* 静止最小值 */
+static uint16_t g_still_hi[TCRT5000_CHANNEL_NUM]; /* 静止最大值 */
+
+/**
+ * @brief 切换阶段并下发对应的电机命令
+ */
+static void calib_goto(CalibPhase phase, uint32_t duration_ms) {
+  g_phase = phase;
+  g_phase_deadline = osal_get_jiffies() + osal_msecs_to_jiffies(duration_ms);
+
+  if (phase == CALIB_SPIN_LEFT)
+    drive_ctrl_set_percent(-CALIB_SPIN_SPEED, CALIB_SPIN_SPEED);
+  else if (phase == CALIB_SPIN_RIGHT)
+    drive_ctrl_set_percent(CALIB_SPIN_SPEED, -CALIB_SPIN_SPEED);
+  else
+    drive_ctrl_stop();
+}
+
+/**
+ * @brief 由采样极值计算一路传感器的标定数据
+ * @return true 该通道标定有效
+ */
+static bool calib_compute_channel(int i, Tcrt5000Profile* p) {
+  uint16_t span = (uint16_t)(g_max_mv[i] - g_min_mv[i]);
+  uint16_t noise = (uint16_t)(g_still_hi[i] - g_still_lo[i]);
+
+  if (span < CALIB_MIN_SPAN_MV || span < noise * CALIB_MIN_SNR) return false;
+
+  uint16_t hyst = span / CALIB_HYST_DIV;
+  if (hyst < noise * 2) hyst = noise * 2;
+  if (hyst < CALIB_HYST_MIN_MV) hyst = CALIB_HYST_MIN_MV;
+
+  uint16_t mid = g_min_mv[i] + span / 2;
+  p->white_mv[i] = g_min_mv[i];
+  p->black_mv[i] = g_max_mv[i];
+  p->noise_mv[i] = noise;
+  p->trigger_mv[i] = mid + hyst / 2;
+  p->release_mv[i] = mid - hyst / 2;
+  return true;
+}
+
+/**
+ * @brief 计算、保存并应用标定结果
+ */
+static void calib_finish(void) {
+  static const char* const names[TCRT5000_CHANNEL_NUM] = {"左", "中", "右"};
+  Tcrt5000Profile profile;
+  bool ok = true;
+
+  tcrt5000_get_profile(&profile);  // 失败时保持原有数据
+  for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+    bool ch_ok = calib_compute_channel(i, &profile);
+    printf("[标定] %s: 白=%u 黑=%u 噪声=%u -> 阈值 %u/%u mV %s\r\n", names[i],
+           g_min_mv[i], g_max_mv[i], g_still_hi[i] - g_still_lo[i],
+           profile.trigger_mv[i], profile.release_mv[i],
+           ch_ok ? "" : "(对比度不足)");
+    ok = ok && ch_ok;
+  }
+
+  if (ok) {
+    tcrt5000_set_profile(&profile);
+    mode_calib_apply_to_estimator(&profile);
+    (void)storage_service_save_ir_profile(&profile);
+    printf("[标定] 完成并已保存\r\n");
+  } else {
+    printf("[标定] 失败：请将小车放在黑线上重新标定\r\n");
+  }
+
+  robot_mgr_set_status(CAR_STOP_STATUS);
+}
+
+void mode_calib_apply_to_estimator(const Tcrt5000Profile* profile) {
+  if (profile == NULL) return;
+  LineCalib calib;
+  for (int i = 0; i < LINE_SENSOR_COUNT; i++) {
+    calib.white_mv[i] = profile->white_mv[i];
+    calib.black_mv[i] = profile->black_mv[i];
+  }
+  line_estimator_set_calib(&calib);
+}
+
+void mode_calib_enter(void) {
+  printf("进入红外标定模式：静止 %dms，左右慢转各 %dms\r\n", CALIB_NOISE_MS,
+         CALIB_SPIN_MS);
+  for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+    g_min_mv[i] = g_still_lo[i] = UINT16_MAX;
+    g_max_mv[i] = g_still_hi[i] = 0;
+  }
+  calib_goto(CALIB_NOISE, CALIB_NOISE_MS);
+}
+
+void mode_calib_tick(void) {
+  Tcrt5000SampleSet ir;
+  robot_mgr_get_ir(&ir);
+  const uint32_t* mv = ir.mv;
+
+  for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+    uint16_t v = mv[i] > UINT16_MAX ? UINT16_MAX : (uint16_t)mv[i];
+    if (g_phase == CALIB_NOISE) {
+      if (v < g_still_lo[i]) g_still_lo[i] = v;
+      if (v > g_still_hi[i]) g_still_hi[i] = v;
+    }
+    if (v < g_min_mv[i]) g_min_mv[i] = v;
+    if (v > g_max_mv[i]) g_max_mv[i] = v;
+  }
+
+  if (osal_get_jiffies() < g_phase_deadline) return;
+
+  switch (g_phase) {
+    case CALIB_NOISE:
+      calib_goto(CALIB_SPIN_LEFT, CALIB_SPIN_MS);
+      break;
+    case CALIB_SPIN_LEFT:
+      calib_goto(CALIB_SPIN_RIGHT, CALIB_SPIN_MS);
+      break;
+    case CALIB_SPIN_RIGHT:
+      drive_ctrl_stop();
+      calib_finish();
+      break;
+  }
+}
+
+void mode_calib_exit(void) { drive_ctrl_stop(); }
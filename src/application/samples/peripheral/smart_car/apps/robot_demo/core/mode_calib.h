@@ -0,0 +1,18 @@
+#ifndef MODE_CALIB_H
+#define MODE_CALIB_H
+
+#include "../../../drivers/tcrt5000/bsp_tcrt5000.h"
+
+/*
+ * 红外传感器标定模式：车放在黑线上，进入模式后先静止采样测噪声，
+ * 再原地左右慢转让三路传感器都扫过黑线，记录每路最小/最大值，
+ * 计算阈值与滞回后写入 NV 并立即生效，完成后自动回到待机模式
+ */
+void mode_calib_enter(void);
+void mode_calib_tick(void);
+void mode_calib_exit(void);
+
+// 将标定数据同步到线位置估计器（白/黑电平）
+void mode_calib_apply_to_estimator(const Tcrt5000Profile* profile);
+
+#endif
@@ -3,63 +3,219 @@
 #include <stdio.h>
 
 #include "../../../drivers/hcsr04/bsp_hcsr04.h"
-#include "../../../drivers/l9110s/bsp_l9110s.h"
+#include "drive_ctrl.h"
 #include "robot_config.h"
 #include "robot_mgr.h"
+#include "soc_osal.h"
+#include "tcxo.h"
 
 /* ================= 参数配置 ================= */
-#define OBSTACLE_LIMIT 20.0f  // 障碍物判定距离 (cm)
-#define TIME_BACK_MS 300      // 后退一下的时间 (防止转弯蹭墙)
-#define TIME_TURN_90_MS 650   // 原地转90度所需时间 (根据车速调整)
-#define TIME_WAIT_STABLE 300  // 每次转完停顿检测的时间
+#define OBSTACLE_LIMIT 20.0f    // 障碍物判定距离 (cm)
+#define BRAKE_LOOKAHEAD_S 0.3f  // 按接近速度提前刹车的预测时间
+#define BLIND_PERCENT 40        // 持续无回波（距离未知）时的巡航速度
+#define TIME_STOP_MS 100        // 刹停等待时间
+#define TIME_BACK_MS 300        // 后退一下的时间 (防止转弯蹭墙)
+#define TIME_PAUSE_MS 100       // 后退后停顿时间
+#define TIME_TURN_90_MS 650     // 无编码器时原地转90度所需时间 (根据车速调整)
+#define TIME_TURN_MAX_MS 2000   // 按角度转向的超时保护（轮子打滑 / 卡住）
+#define TURN_ANGLE_RAD 1.5708f  // 按角度转向的目标转角 (90 度)
+#define TIME_WAIT_STABLE 300    // 每次转完停顿检测的时间
 
 /**
- * @brief 避障模式进入
+ * @brief 避障状态
+ * @note 每个状态只在进入时下发一次电机命令，之后仅检查是否到期，
+ *       tick 永不阻塞
  */
-void mode_obstacle_enter(void) {
-  printf("进入智能避障模式\r\n");
-  CAR_STOP();
+typedef enum {
+  OBS_CRUISE = 0,  // 前方开阔，直行并周期测距
+  OBS_STOP,        // 刹停
+  OBS_BACK,        // 后退
+  OBS_PAUSE,       // 后退后停顿
+  OBS_TURN,        // 原地左转
+  OBS_SETTLE,      // 转完停车稳住
+  OBS_PROBE,       // 测距决定继续前进还是重新突围
+  OBS_HOLD         // 测距停摆：停车等待新结果，不做盲目突围
+} ObstacleState;
+
+static ObstacleState g_state = OBS_CRUISE;
+static unsigned long long g_state_deadline = 0; /* 当前状态到期时刻 */
+static uint32_t g_last_sonar_seq = 0;           /* 上次使用的测距序号 */
+static uint32_t g_tick_max_us = 0;              /* 最坏 tick 耗时 */
+static float g_turn_start_rad = 0.0f;           /* 转向开始时的累计航向 */
+static bool g_blind = false;                    /* 最近一次测距是否距离未知 */
+
+/**
+ * @brief 切换状态并下发对应的电机命令
+ * @param state 新状态
+ * @param duration_ms 状态持续时间 (ms)，0 表示不限时
+ */
+static void obstacle_goto(ObstacleState state, uint32_t duration_ms) {
+  g_state = state;
+  g_state_deadline = osal_get_jiffies() + osal_msecs_to_jiffies(duration_ms);
+
+  switch (state) {
+    case OBS_CRUISE:
+      drive_ctrl_set_percent(g_blind ? BLIND_PERCENT : 100,
+                             g_blind ? BLIND_PERCENT : 100);
+      break;
+    case OBS_BACK:
+      drive_ctrl_set_percent(-100, -100);
+      break;
+    case OBS_TURN: {
+      OdometryPose pose;
+      drive_ctrl_get_pose(&pose);
+      g_turn_start_rad = pose.heading_total_rad;
+      drive_ctrl_set_percent(0, 100);  // 以左轮为轴左转
+      break;
+    }
+    default:  // STOP / PAUSE / SETTLE / PROBE 均为停车
+      drive_ctrl_stop();
+      break;
+  }
 }
 
 /**
- * @brief 避障模式周期回调
+ * @brief 取滤波后的新测距结果，换算为用于判定的有效距离
+ * @param out 输出有效距离 (cm)：
+ *            - 正常：按接近速度预测 BRAKE_LOOKAHEAD_S 后的距离，车速越快越早刹车
+ *            - 回波过近（紧贴障碍物）：0（受阻）
+ *            - 持续无回波：保持最后一次估计并置 g_blind，巡航时减速，
+ *              从未测到有效距离时为 0（未知不等于开阔）
+ * @return true 有尚未使用过的新结果
+ * @note 测距停摆由 obstacle_sonar_stalled 在状态机之前处理
  */
-void mode_obstacle_tick(void) {
-  // 1. 获取当前前方距离
-  float current_dist = hcsr04_get_distance();
-  robot_mgr_update_distance(current_dist);
+static bool obstacle_sample_distance(float* out) {
+  SonarEstimate est;
+  robot_mgr_get_sonar(&est);
 
-  // 情况 A: 前方开阔，直接走
-  if (current_dist > OBSTACLE_LIMIT) {
-    CAR_FORWARD();
-    return;
+  if (est.seq == g_last_sonar_seq) return false;
+  g_last_sonar_seq = est.seq;
+
+  g_blind = !est.valid;
+  if (g_blind || est.too_close) {
+    *out = est.distance_cm;
+    return true;
   }
 
-  // 情况 B: 前方受阻，进入"尝试突围"流程
-  printf("前方受阻(%.1fcm)，开始尝试寻找出口...\r\n", current_dist);
-
-  CAR_STOP();  // 先停车
-  osal_msleep(100);
-  CAR_BACKWARD();  // 1. 稍微后退
-  osal_msleep(TIME_BACK_MS);
-  CAR_STOP();
-  osal_msleep(100);
-  CAR_LEFT();  // 2. 左转 90 度
-  osal_msleep(TIME_TURN_90_MS);
-  CAR_STOP();  // 3. 停车稳住
-  osal_msleep(TIME_WAIT_STABLE);
-
-  float new_dist = hcsr04_get_distance();
-  printf("转向后距离: %.1f\r\n", new_dist);
-
-  if (new_dist > OBSTACLE_LIMIT) {
-    printf("找到出口！继续前进。\r\n");
-    CAR_FORWARD();
+  float closing = est.closing_speed_cm_s > 0.0f ? est.closing_speed_cm_s : 0.0f;
+  *out = est.distance_cm - closing * BRAKE_LOOKAHEAD_S;
+  if (*out < 0.0f) *out = 0.0f;
+  return true;
+}
+
+/**
+ * @brief 测距是否停摆（从未出结果，或最近结果已超过 SONAR_STALE_MS）
+ */
+static bool obstacle_sonar_stalled(void) {
+  SonarEstimate est;
+  robot_mgr_get_sonar(&est);
+  return est.seq == 0 || uapi_tcxo_get_us() - est.timestamp_us >
+                             (uint64_t)SONAR_STALE_MS * 1000ULL;
+}
+
+/**
+ * @brief 原地左转是否已完成
+ * @param expired 转向时间是否已到
+ * @note 两轮编码器都在工作时按里程计转角判定，TIME_TURN_MAX_MS 仅作超时保护；
+ *       否则沿用按时间转向
+ */
+static bool obstacle_turn_done(bool expired) {
+  if (!drive_ctrl_has_encoder()) return expired;
+
+  OdometryPose pose;
+  drive_ctrl_get_pose(&pose);
+  return pose.heading_total_rad - g_turn_start_rad >= TURN_ANGLE_RAD || expired;
+}
+
+/**
+ * @brief 执行一步状态机
+ */
+static void obstacle_step(void) {
+  float dist = 0.0f;
+  bool expired = osal_get_jiffies() >= g_state_deadline;
+
+  // 测距停摆时无论处于哪一步都停车原地等待，按受阻处理但不盲目后退转向
+  if (obstacle_sonar_stalled()) {
+    if (g_state != OBS_HOLD) {
+      printf("测距停摆，停车等待...\r\n");
+      obstacle_goto(OBS_HOLD, 0);
+    }
     return;
   }
+
+  switch (g_state) {
+    case OBS_CRUISE:
+      // 情况 A: 前方开阔，直接走；情况 B: 前方受阻，进入"尝试突围"流程
+      if (!obstacle_sample_distance(&dist)) break;
+      if (dist > OBSTACLE_LIMIT) {
+        drive_ctrl_set_percent(g_blind ? BLIND_PERCENT : 100,
+                               g_blind ? BLIND_PERCENT : 100);
+      } else {
+        printf("前方受阻(%.1fcm)，开始尝试寻找出口...\r\n", dist);
+        obstacle_goto(OBS_STOP, TIME_STOP_MS);  // 先停车
+      }
+      break;
+    case OBS_STOP:  // 1. 稍微后退
+      if (expired) obstacle_goto(OBS_BACK, TIME_BACK_MS);
+      break;
+    case OBS_BACK:
+      if (expired) obstacle_goto(OBS_PAUSE, TIME_PAUSE_MS);
+      break;
+    case OBS_PAUSE:  // 2. 左转 90 度
+      if (expired)
+        obstacle_goto(OBS_TURN, drive_ctrl_has_encoder() ? TIME_TURN_MAX_MS
+                                                         : TIME_TURN_90_MS);
+      break;
+    case OBS_TURN:  // 3. 停车稳住
+      if (obstacle_turn_done(expired))
+        obstacle_goto(OBS_SETTLE, TIME_WAIT_STABLE);
+      break;
+    case OBS_SETTLE:
+      if (expired) obstacle_goto(OBS_PROBE, 0);
+      break;
+    case OBS_PROBE:
+      if (!obstacle_sample_distance(&dist)) break;  // 等待新测距结果
+      printf("转向后距离: %.1f\r\n", dist);
+      if (dist > OBSTACLE_LIMIT) {
+        printf("找到出口！继续前进。\r\n");
+        obstacle_goto(OBS_CRUISE, 0);
+      } else {
+        obstacle_goto(OBS_STOP, TIME_STOP_MS);  // 仍受阻，重新突围
+      }
+      break;
+    case OBS_HOLD:
+      // 测距恢复：保持停车回到巡航，由下一个新结果决定是否前进
+      printf("测距恢复\r\n");
+      g_state = OBS_CRUISE;
+      break;
+  }
+}
+
+/**
+ * @brief 避障模式进入
+ */
+void mode_obstacle_enter(void) {
+  printf("进入智能避障模式\r\n");
+  g_last_sonar_seq = 0;
+  g_tick_max_us = 0;
+  g_blind = false;
+  g_state = OBS_CRUISE;  // 首次测距后再决定是否前进
+  drive_ctrl_stop();
+}
+
+/**
+ * @brief 避障模式周期回调
+ */
+void mode_obstacle_tick(void) {
+  uint64_t t0 = uapi_tcxo_get_us();
+  obstacle_step();
+  uint32_t cost = (uint32_t)(uapi_tcxo_get_us() - t0);
+  if (cost > g_tick_max_us) g_tick_max_us = cost;
 }
 
 /**
  * @brief 避障模式退出
  */
-void mode_obstacle_exit(void) { CAR_STOP(); }
\ No newline at end of file
+void mode_obstacle_exit(void) { drive_ctrl_stop(); }
+
+uint32_t mode_obstacle_get_max_tick_us(void) { return g_tick_max_us; }
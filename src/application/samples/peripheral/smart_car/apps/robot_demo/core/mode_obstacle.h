@@ -1,8 +1,13 @@
 #ifndef MODE_OBSTACLE_H
 #define MODE_OBSTACLE_H
 
+#include <stdint.h>
+
 void mode_obstacle_enter(void);
 void mode_obstacle_tick(void);
 void mode_obstacle_exit(void);
 
+// 获取避障 tick 的最坏耗时 (us)，进入模式时清零
+uint32_t mode_obstacle_get_max_tick_us(void);
+
 #endif
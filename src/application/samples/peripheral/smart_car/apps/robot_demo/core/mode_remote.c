@@ -2,49 +2,59 @@
 
 #include <stdio.h>
 
-#include "../../../drivers/l9110s/bsp_l9110s.h"
 #include "../services/sle_service.h"
-#include "../services/udp_service.h"
-#include "../services/voice_service.h"
+#include "cmd_bus.h"
+#include "drive_ctrl.h"
 #include "robot_config.h"
-#include "soc_osal.h"
-
-#define TIMEOUT_MS 500  // 信号丢失保护时间
-
-static unsigned long long g_last_tick = 0;  // 上次收到命令的时间
+#include "securec.h"
+#include "tcxo.h"
+
+// 来源优先级: 语音 > SLE > WiFi UDP
+static const RobotEventSource g_priority[] = {ROBOT_SRC_VOICE, ROBOT_SRC_SLE,
+                                              ROBOT_SRC_UDP};
+
+static BusCmd g_cache[ROBOT_SRC_NUM];  // 各来源最近一次读到的命令
+static uint64_t g_actuated_rx_us[ROBOT_SRC_NUM];  // 各来源已执行命令的接收时间
+
+/**
+ * @brief 读取某来源的最新命令，写者正在更新时沿用上次读到的副本
+ */
+static const BusCmd* remote_fetch(RobotEventSource source) {
+  BusCmd cmd;
+  if (cmd_bus_read(source, &cmd)) g_cache[source] = cmd;
+  return &g_cache[source];
+}
 
 void mode_remote_enter(void) {
   printf("Robot: 遥控模式\r\n");
-  l9110s_set_differential(0, 0);  // 先停车
-  g_last_tick = osal_get_jiffies();
+  drive_ctrl_stop();  // 先停车
+  (void)memset_s(g_cache, sizeof(g_cache), 0, sizeof(g_cache));
 }
 
 void mode_remote_tick(void) {
-  int8_t m1 = 0, m2 = 0;
-  bool has_new_cmd = false;
-
-  // 优先级: 语音 > SLE > WiFi UDP
-  // 1. 先看串口有没有命令
-  if (voice_service_is_cmd_active()) {
-    voice_service_get_motor_cmd(&m1, &m2);
-    has_new_cmd = true;
-  } else if (sle_service_is_connected() && sle_service_pop_cmd(&m1, &m2)) {
-    // 2. 再看 SLE 有没有命令
-    has_new_cmd = true;
-  } else {
-    // 3. 最后看 WiFi 有没有命令
-    // 把缓冲区里的旧数据全部扔掉，只保留最后一次的 m1,m2
-    while (udp_service_pop_cmd(&m1, &m2)) has_new_cmd = true;
+  uint64_t now = uapi_tcxo_get_us();
+
+  // 按优先级选取第一个仍在有效期内的命令
+  for (size_t i = 0; i < sizeof(g_priority) / sizeof(g_priority[0]); i++) {
+    RobotEventSource src = g_priority[i];
+    if (src == ROBOT_SRC_SLE && !sle_service_is_connected()) continue;
+
+    const BusCmd* cmd = remote_fetch(src);
+    if (!cmd_bus_is_valid(cmd, now)) continue;
+
+    drive_ctrl_set_percent(cmd->m1, cmd->m2);  // 百分比按最高轮速换算
+    if (cmd->rx_us != g_actuated_rx_us[src]) {  // 新命令首次执行时记录延迟
+      g_actuated_rx_us[src] = cmd->rx_us;
+      cmd_bus_mark_actuated(cmd, uapi_tcxo_get_us());
+    }
+    return;
   }
 
-  if (has_new_cmd) {  // 1: 收到新指令 -> 刷新时间，执行动作
-    g_last_tick = osal_get_jiffies();
-    l9110s_set_differential(m1, m2);
-  } else {  // 2: 没有新指令 -> 检查是不是断联了
-    unsigned long long now = osal_get_jiffies();
-    if ((now - g_last_tick) > osal_msecs_to_jiffies(TIMEOUT_MS))
-      l9110s_set_differential(0, 0);
-  }
+  // 所有来源都已失效（信号丢失保护）
+  drive_ctrl_stop();
 }
 
-void mode_remote_exit(void) { l9110s_set_differential(0, 0); }
\ No newline at end of file
+void mode_remote_exit(void) {
+  drive_ctrl_stop();
+  cmd_bus_dump_stats();
+}
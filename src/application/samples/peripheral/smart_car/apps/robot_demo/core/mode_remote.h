@@ -1,6 +1,10 @@
 #ifndef MODE_REMOTE_H
 #define MODE_REMOTE_H
 
+/*
+ * 遥控模式：从命令总线 (cmd_bus) 按来源优先级选取有效命令执行，
+ * 全部来源失效时停车
+ */
 void mode_remote_enter(void);
 void mode_remote_tick(void);
 void mode_remote_exit(void);
@@ -0,0 +1,169 @@
+#include "mode_scan.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "../../../drivers/hcsr04/bsp_hcsr04.h"
+#include "../../../drivers/sg90/bsp_sg90.h"
+#include "drive_ctrl.h"
+#include "polar_map.h"
+#include "robot_config.h"
+#include "tcxo.h"
+
+/* ================= 参数配置 ================= */
+#define SCAN_SECTORS 7              // 扫描扇区数
+#define SCAN_FOV_DEG 120.0f         // 扫描总角度（正前方左右各 60 度）
+#define SCAN_RANGE_CM 60.0f         // 关注距离，更远的回波视为开阔
+#define SCAN_CV_MAX 3               // 扇区确定度上限
+#define SCAN_THRESHOLD 0.25f        // 可通行密度阈值（孤立扇区单次 30cm 内即阻塞）
+#define SCAN_WIDE_SECTORS 3         // 宽谷门限
+#define SCAN_SERVO_DIR 1            // 舵机角度增大方向：1 向左，-1 向右
+#define SCAN_SETTLE_EXTRA_US 20000  // 舵机转到位后额外的稳定时间
+#define SCAN_FRONT_HALF_DEG 20.0f   // 正前方范围（调速时取其中最近距离）
+#define SCAN_SPEED_MM_S 300.0f      // 巡航速度
+#define SCAN_SPIN_MM_S 150.0f       // 无路时原地旋转的轮速
+#define SCAN_STOP_CM 20.0f          // 距离小于该值时只转向不前进
+#define SCAN_SLOW_CM 60.0f          // 距离小于该值时开始线性减速
+#define SCAN_UNKNOWN_CM 40.0f       // 无回波扇区按该距离减速（未知不等于开阔）
+#define SCAN_TURN_GAIN 2.0f         // 转向增益：角速度 (rad/s) / 方向偏角 (rad)
+
+#define SCAN_DEG2RAD 0.01745329f
+
+static PolarMap g_map;            /* 极坐标直方图 */
+static int g_idx = 0;             /* 舵机当前所在扇区 */
+static int g_step = 1;            /* 扫描方向：1 向左，-1 向右 */
+static uint64_t g_settle_us = 0;  /* 舵机转到位的时刻 */
+static uint32_t g_sonar_seq = 0;  /* 上次使用的测距序号 */
+static int g_spin_sign = 1;       /* 无路时的旋转方向：1 左转，-1 右转 */
+
+/**
+ * @brief 舵机转到指定扇区，并估算转到位的时刻
+ */
+static void scan_point_servo(int idx, uint64_t now) {
+  float from = (float)sg90_get_angle();
+  float to = SG90_ANGLE_CENTER +
+             SCAN_SERVO_DIR * polar_map_sector_angle(&g_map, idx);
+  float travel = to > from ? to - from : from - to;
+
+  sg90_set_angle((unsigned int)(to + 0.5f));
+  g_idx = idx;
+  g_settle_us = now + (uint64_t)(travel * SG90_US_PER_DEG) +
+                SCAN_SETTLE_EXTRA_US;
+}
+
+/**
+ * @brief 扫描：舵机到位后取一次新测距写入直方图，再转向下一个扇区
+ * @note 连续测距与舵机不同步，回波起始时刻早于到位时刻的结果属于
+ *       转动途中的方向，丢弃后等待下一次
+ */
+static void scan_sweep(void) {
+  uint64_t now = uapi_tcxo_get_us();
+  if (now < g_settle_us) return;
+
+  Hcsr04Reading reading;
+  if (!hcsr04_get_latest(&reading) || reading.seq == g_sonar_seq) return;
+  g_sonar_seq = reading.seq;
+  if (reading.timestamp_us < g_settle_us + reading.pulse_us) return;
+
+  SonarInput input = SONAR_INPUT_ECHO;
+  if (!reading.valid)
+    input = hcsr04_reading_too_close(&reading) ? SONAR_INPUT_NEAR
+                                               : SONAR_INPUT_NONE;
+  polar_map_update(&g_map, g_idx, reading.distance_cm, input);
+
+  // 往复扫描，端点不重复测量
+  int next = g_idx + g_step;
+  if (next < 0 || next >= SCAN_SECTORS) {
+    g_step = -g_step;
+    next = g_idx + g_step;
+  }
+  scan_point_servo(next, now);
+}
+
+/**
+ * @brief 正前方范围内的最近距离
+ */
+static float scan_front_clearance(void) {
+  float nearest = SCAN_RANGE_CM;
+  for (int i = 0; i < SCAN_SECTORS; i++) {
+    float a = polar_map_sector_angle(&g_map, i);
+    if (a < -SCAN_FRONT_HALF_DEG || a > SCAN_FRONT_HALF_DEG) continue;
+    if (g_map.sector[i].distance_cm < nearest)
+      nearest = g_map.sector[i].distance_cm;
+  }
+  return nearest;
+}
+
+/**
+ * @brief 按直方图选向并下发两轮速度
+ */
+static void scan_drive(void) {
+  if (!polar_map_ready(&g_map)) {  // 首轮扫描完成前原地等待
+    drive_ctrl_set_speed(0.0f, 0.0f);
+    return;
+  }
+
+  PolarSteer steer;
+  if (!polar_map_select(&g_map, 0.0f, &steer)) {
+    // 无可通行方向：朝上次转向的一侧原地旋转，直到扫描出新的谷
+    drive_ctrl_set_speed(-g_spin_sign * SCAN_SPIN_MM_S,
+                         g_spin_sign * SCAN_SPIN_MM_S);
+    return;
+  }
+  if (steer.angle_deg > 0.0f) g_spin_sign = 1;
+  if (steer.angle_deg < 0.0f) g_spin_sign = -1;
+
+  // 前进速度：按所选方向和正前方中较近的距离线性减速，偏角越大越慢
+  float clearance = steer.clearance_cm;
+  float front = scan_front_clearance();
+  if (front < clearance) clearance = front;
+  float scale = (clearance - SCAN_STOP_CM) / (SCAN_SLOW_CM - SCAN_STOP_CM);
+  if (scale < 0.0f) scale = 0.0f;
+  if (scale > 1.0f) scale = 1.0f;
+
+  float heading = steer.angle_deg * SCAN_DEG2RAD;
+  float v = SCAN_SPEED_MM_S * scale * cosf(heading);
+  if (v < 0.0f) v = 0.0f;
+
+  // 角速度正比于方向偏角，换算为两轮速度差（左正右负，左转右轮快）
+  float diff = SCAN_TURN_GAIN * heading * WHEEL_TRACK_MM * 0.5f;
+  drive_ctrl_set_speed(v - diff, v + diff);
+}
+
+/**
+ * @brief 扫描避障模式进入
+ */
+void mode_scan_enter(void) {
+  printf("进入扫描避障模式\r\n");
+  PolarMapConfig cfg = {.sectors = SCAN_SECTORS,
+                        .fov_deg = SCAN_FOV_DEG,
+                        .range_cm = SCAN_RANGE_CM,
+                        .cv_max = SCAN_CV_MAX,
+                        .threshold = SCAN_THRESHOLD,
+                        .wide_sectors = SCAN_WIDE_SECTORS,
+                        .unknown_cm = SCAN_UNKNOWN_CM};
+  polar_map_init(&g_map, &cfg);
+
+  Hcsr04Reading reading;
+  g_sonar_seq = hcsr04_get_latest(&reading) ? reading.seq : 0;
+  g_step = 1;
+  g_spin_sign = 1;
+  scan_point_servo(0, uapi_tcxo_get_us());  // 从最右侧开始
+  drive_ctrl_stop();
+}
+
+/**
+ * @brief 扫描避障模式周期回调
+ */
+void mode_scan_tick(void) {
+  scan_sweep();
+  scan_drive();
+}
+
+/**
+ * @brief 扫描避障模式退出：停车，舵机回正供普通避障模式使用
+ */
+void mode_scan_exit(void) {
+  drive_ctrl_stop();
+  sg90_set_angle(SG90_ANGLE_CENTER);
+}
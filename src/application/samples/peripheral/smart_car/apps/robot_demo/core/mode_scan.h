@@ -0,0 +1,16 @@
+#ifndef MODE_SCAN_H
+#define MODE_SCAN_H
+
+/*
+ * 扫描避障模式（舵机云台 + 极坐标直方图）：
+ * 1. 超声波装在舵机上，行驶中在前方扇形范围内往复扫描，每个扇区
+ *    在舵机转到位后取一次连续测距的新结果
+ * 2. 结果写入 polar_map 直方图，每个控制周期选出最宽的可通行谷
+ * 3. 按所选方向差速转向，按方向和正前方的距离连续调速，不停车后退；
+ *    完全无路时原地旋转直到扫描出新的谷
+ */
+void mode_scan_enter(void);
+void mode_scan_tick(void);
+void mode_scan_exit(void);
+
+#endif
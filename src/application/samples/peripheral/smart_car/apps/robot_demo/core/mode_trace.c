@@ -2,26 +2,37 @@
 
 #include <stdio.h>
 
-#include "../../../drivers/l9110s/bsp_l9110s.h"
 #include "../../../drivers/tcrt5000/bsp_tcrt5000.h"
 #include "../services/storage_service.h"
-#include "adc.h"
+#include "drive_ctrl.h"
+#include "line_estimator.h"
+#include "pid_ctrl.h"
 #include "robot_config.h"
 #include "robot_mgr.h"
+#include "tcxo.h"
 
 // 循迹速度参数配置
 #define TRACE_SPEED_FORWARD 40     // 默认直行速度
 #define TRACE_LOST_TIMEOUT_MS 300  // 丢失黑线后继续行驶的超时时间(ms)
 #define TRACE_SEARCH_SPEED 30      // 丢线后搜索速度
 
+// PID 控制器配置（NV 系数按 PID_NV_DT_S 换算为连续时间系数，
+// 使控制频率变化后调参结果保持不变）
+#define TRACE_PID_OUT_LIMIT 100.0f    // 输出限幅（与差速范围一致）
+#define TRACE_PID_I_BAND 1.0f         // 积分分离带：|误差|>1 时清零积分
+#define TRACE_PID_D_CUTOFF_HZ 10.0f   // 微分低通截止频率
+#define TRACE_PID_MAX_DT_US 100000    // 两拍间隔上限，超过视为中断过（如丢线）
+
 // PID 参数
 static float g_kp = 16.0f;                     /* 比例系数 Kp */
 static float g_ki = 0.0f;                      /* 积分系数 Ki */
 static float g_kd = 0.0f;                      /* 微分系数 Kd */
 static int g_base_speed = TRACE_SPEED_FORWARD; /* 基础前进速度 */
 
-static float g_last_error = 0; /* 上次误差值（用于微分计算） */
-static float g_integral = 0;   /* 误差积分值（用于积分计算） */
+static PidCtrl g_pid;              /* 转向 PID 控制器 */
+static uint64_t g_last_pid_us = 0; /* 上次 PID 计算时刻（用于实际 dt） */
+
+static TraceErrorSource g_error_source = TRACE_ERROR_DIGITAL; /* 误差来源 */
 
 static unsigned long long g_last_seen_tick = 0; /* 上次检测到黑线的时间 */
 static float g_last_valid_error = 0; /* 上次有效误差值（用于丢线后反向搜索） */
@@ -72,10 +83,8 @@ void mode_trace_enter(void) {
   // 进入模式时初始化时间戳，防止误判
   g_last_seen_tick = osal_get_jiffies();
 
-  // 重置 PID 状态
-  g_last_error = 0;
-  g_integral = 0;
   g_last_valid_error = 0;  // 重置上次有效误差
+  line_estimator_reset();
 
   // 从 NV 加载 PID 参数
   float kp, ki, kd;
@@ -86,6 +95,20 @@ void mode_trace_enter(void) {
   g_kd = kd;
   g_base_speed = speed;
 
+  // 初始化 PID 控制器（同时清零积分和微分历史）
+  PidConfig cfg = {
+      .kp = g_kp,
+      .ki = g_ki / PID_NV_DT_S,
+      .kd = g_kd * PID_NV_DT_S,
+      .out_min = -TRACE_PID_OUT_LIMIT,
+      .out_max = TRACE_PID_OUT_LIMIT,
+      .i_band = TRACE_PID_I_BAND,
+      .d_cutoff_hz = TRACE_PID_D_CUTOFF_HZ,
+      .anti_windup = PID_AW_CONDITIONAL,
+  };
+  pid_init(&g_pid, &cfg);
+  g_last_pid_us = 0;
+
   // 浮点数转整数打印
   int kp_int = (int)(g_kp * 100);
   int ki_int = (int)(g_ki * 1000);
@@ -96,9 +119,24 @@ void mode_trace_enter(void) {
          (kd_int >= 0 ? kd_int : -kd_int) % 100, g_base_speed);
 }
 
+void mode_trace_set_error_source(TraceErrorSource source) {
+  if (source != TRACE_ERROR_DIGITAL && source != TRACE_ERROR_ANALOG) return;
+  g_error_source = source;
+  line_estimator_reset();
+  printf("循迹误差来源: %s\r\n",
+         source == TRACE_ERROR_ANALOG ? "模拟量质心" : "数字查表");
+}
+
+TraceErrorSource mode_trace_get_error_source(void) { return g_error_source; }
+
 // 设置 PID 参数
-// type: 1=Kp, 2=Ki, 3=Kd, 4=Speed
+// type: 1=Kp, 2=Ki, 3=Kd, 4=Speed, 5=误差来源
 void mode_trace_set_pid(int type, int value) {
+  if (type == 5) {  // 误差来源不属于 PID 参数，不写 NV
+    mode_trace_set_error_source((TraceErrorSource)value);
+    return;
+  }
+
   if (type == 1)
     g_kp = (float)value / 1000.0f;
   else if (type == 2)
@@ -113,9 +151,10 @@ void mode_trace_set_pid(int type, int value) {
   // 保存到 NV
   storage_service_save_pid_params(g_kp, g_ki, g_kd, (int16_t)g_base_speed);
 
-  // 重置积分，避免突变
-  g_integral = 0;
-  g_last_error = 0;
+  // 更新控制器系数并重置积分，避免突变
+  pid_set_gains(&g_pid, g_kp, g_ki / PID_NV_DT_S, g_kd * PID_NV_DT_S);
+  pid_reset(&g_pid);
+  g_last_pid_us = 0;
 }
 
 /*
@@ -130,73 +169,55 @@ void mode_trace_set_pid(int type, int value) {
  * @return PID 输出值
  */
 static float calculate_pid(float error) {
-  // 1. 累加积分
-  g_integral += error;
-
-  // 2. 积分限幅 (防止积分饱和)
-  if (g_integral > 50) g_integral = 50;
-  if (g_integral < -50) g_integral = -50;
-
-  // 3. 积分分离 (大误差时不积分)
-  if (error > 1 || error < -1) {
-    g_integral = 0;
+  // 按两次计算之间的实际时间积分/微分，首拍使用名义周期
+  uint64_t now_us = uapi_tcxo_get_us();
+  uint32_t dt_us = 1000000 / CONTROL_LOOP_HZ;
+  if (g_last_pid_us != 0) {
+    uint64_t elapsed = now_us - g_last_pid_us;
+    if (elapsed > TRACE_PID_MAX_DT_US)
+      pid_reset(&g_pid);  // 历史已失效，避免一次性大步积分
+    else
+      dt_us = (uint32_t)elapsed;
   }
+  g_last_pid_us = now_us;
 
-  // 4. 计算 P, I, D 三项
-  float p_term = g_kp * error;
-  float i_term = g_ki * g_integral;
-  float d_term = g_kd * (error - g_last_error);
-
-  // 5. 更新上次误差
-  g_last_error = error;
-
-  return p_term + i_term + d_term;
+  pid_value_t out = pid_update(&g_pid, PID_FROM_FLOAT(error), 0, dt_us);
+  return PID_TO_FLOAT(out);
 }
 
 void mode_trace_tick(void) {
-  // 触发ADC采样
-  adc_scan_config_t config = {.type = 0, .freq = 1};
-  uapi_adc_auto_scan_ch_enable(TCRT5000_LEFT_ADC_CHANNEL, config,
-                               tcrt5000_adc_callback);
-  uapi_adc_auto_scan_ch_disable(TCRT5000_LEFT_ADC_CHANNEL);
-
-  uapi_adc_auto_scan_ch_enable(TCRT5000_MIDDLE_ADC_CHANNEL, config,
-                               tcrt5000_adc_callback);
-  uapi_adc_auto_scan_ch_disable(TCRT5000_MIDDLE_ADC_CHANNEL);
-
-  uapi_adc_auto_scan_ch_enable(TCRT5000_RIGHT_ADC_CHANNEL, config,
-                               tcrt5000_adc_callback);
-  uapi_adc_auto_scan_ch_disable(TCRT5000_RIGHT_ADC_CHANNEL);
-
-  // 获取传感器状态
-  unsigned int left = tcrt5000_get_left();
-  unsigned int middle = tcrt5000_get_middle();
-  unsigned int right = tcrt5000_get_right();
+  // 获取后台采集的最新一组传感器数据（左/中/右同一组）
+  Tcrt5000SampleSet ir;
+  robot_mgr_get_ir(&ir);
+  unsigned int left = ir.state[0];
+  unsigned int middle = ir.state[1];
+  unsigned int right = ir.state[2];
   unsigned long long now = osal_get_jiffies();
 
-  // 调试信息：每20次循环打印一次
-  static int debug_cnt = 0;
-  if (++debug_cnt >= 20) {
-    debug_cnt = 0;
-    // 打印传感器状态和ADC原始值
-    printf("TRACE: L=%d M=%d R=%d, ADC: L=%d M=%d R=%d mV\n", left, middle,
-           right, tcrt5000_get_left_adc(), tcrt5000_get_middle_adc(),
-           tcrt5000_get_right_adc());
-  }
-
-  // 更新红外传感器状态到全局状态
-  robot_mgr_update_ir_status(left, middle, right);
-
   // 计算误差 Error
-  float error = calculate_trace_error(left, middle, right);
+  float error;
+  bool on_line;
+  if (g_error_source == TRACE_ERROR_ANALOG) {
+    LineEstimate est;
+    line_estimator_update(ir.mv, &est);
+    error = est.position;
+    on_line = !est.lost;
+  } else {
+    error = calculate_trace_error(left, middle, right);
+    on_line = left == TRACE_DETECT_BLACK || middle == TRACE_DETECT_BLACK ||
+              right == TRACE_DETECT_BLACK;
+  }
 
-  if (left == TRACE_DETECT_BLACK || middle == TRACE_DETECT_BLACK ||
-      right == TRACE_DETECT_BLACK) {
+  if (on_line) {
     g_last_seen_tick = now;
     g_last_valid_error = error;  // 保存当前有效误差，用于丢线后反向搜索
 
     // PID 计算
     float pid_output = calculate_pid(error);
+    robot_mgr_update_pid(error, pid_output);
+    robot_mgr_update_pid_terms(PID_TO_FLOAT(g_pid.p_term),
+                               PID_TO_FLOAT(g_pid.i_term),
+                               PID_TO_FLOAT(g_pid.d_term));
 
     // --- 优化策略 ---
 
@@ -204,9 +225,10 @@ void mode_trace_tick(void) {
     // 当误差较大(拐弯)时，降低基础速度，给车更多时间纠正，防止冲出跑道
     // 注意：速度不能过低，否则电机可能带不动
     int current_base_speed = g_base_speed;
-    if (error >= 2 || error <= -2)
+    // 阈值取在离散误差级之间，两种误差来源共用
+    if (error >= 1.5f || error <= -1.5f)
       current_base_speed = (int)(g_base_speed * 0.6f);  // 降速至 60%
-    else if (error >= 1 || error <= -1)
+    else if (error >= 0.75f || error <= -0.75f)
       current_base_speed = (int)(g_base_speed * 0.9f);  // 90% (轻微减速)
 
     // 使用四舍五入而不是截断，以保留 0.5 级别的微调效果
@@ -226,50 +248,29 @@ void mode_trace_tick(void) {
     if (right_speed > 100) right_speed = 100;
     if (right_speed < -100) right_speed = -100;
 
-    // 调试信息：打印误差和速度
-    if (debug_cnt == 0) {
-      // 浮点数转整数显示：error*100 保留2位小数
-      int error_int = (int)(error * 100);
-      int pid_int = (int)(pid_output * 100);
-      printf("Error=%d.%02d PID=%d.%02d Speed: L=%d R=%d\n", error_int / 100,
-             (error_int >= 0 ? error_int : -error_int) % 100, pid_int / 100,
-             (pid_int >= 0 ? pid_int : -pid_int) % 100, left_speed,
-             right_speed);
-    }
-
-    l9110s_set_differential((int8_t)left_speed, (int8_t)right_speed);
+    drive_ctrl_set_percent((int8_t)left_speed, (int8_t)right_speed);
 
   } else {
     // 未检测到黑线 - 丢线状态
     if (now - g_last_seen_tick < osal_msecs_to_jiffies(TRACE_LOST_TIMEOUT_MS)) {
-      // 调试信息：打印丢线搜索
-      if (debug_cnt == 0) {
-        int err_int = (int)(g_last_valid_error * 100);
-        printf("LOST LINE! Searching... last_err=%d.%02d\n", err_int / 100,
-               (err_int >= 0 ? err_int : -err_int) % 100);
-      }
       // 刚丢失信号不久，使用反向搜索策略
       // 如果上次是左偏（误差为负），向右转来找线；如果上次是右偏（误差为正），向左转来找线
       int search_speed = TRACE_SEARCH_SPEED;
 
       if (g_last_valid_error < -0.5f) {
         // 上次左偏，现在向右转（左轮快，右轮慢）
-        l9110s_set_differential(search_speed, -search_speed / 2);
+        drive_ctrl_set_percent(search_speed, -search_speed / 2);
       } else if (g_last_valid_error > 0.5f) {
         // 上次右偏，现在向左转（左轮慢，右轮快）
-        l9110s_set_differential(-search_speed / 2, search_speed);
+        drive_ctrl_set_percent(-search_speed / 2, search_speed);
       } else {
         // 上次居中，继续直行搜索
-        l9110s_set_differential(search_speed, search_speed);
+        drive_ctrl_set_percent(search_speed, search_speed);
       }
     } else {
-      // 调试信息：打印超时停车
-      if (debug_cnt == 0) {
-        printf("LOST TIMEOUT! STOP.\n");
-      }
-      l9110s_set_differential(0, 0);  // 超时仍未找到，停车
+      drive_ctrl_stop();  // 超时仍未找到，停车
     }
   }
 }
 
-void mode_trace_exit(void) { CAR_STOP(); }
+void mode_trace_exit(void) { drive_ctrl_stop(); }
@@ -1,12 +1,23 @@
 #ifndef MODE_TRACE_H
 #define MODE_TRACE_H
 
+// 循迹误差来源
+typedef enum {
+  TRACE_ERROR_DIGITAL = 0,  // 三路阈值化后查表（5 级离散误差）
+  TRACE_ERROR_ANALOG = 1    // ADC 模拟量加权质心（连续误差）
+} TraceErrorSource;
+
 void mode_trace_enter(void);
 void mode_trace_tick(void);
 void mode_trace_exit(void);
 
 // 设置 PID 参数 (Kp, Ki, Kd, BaseSpeed)
 // 值为放大100倍的整数，除了 speed 是原值
+// type=5 时 value 为误差来源 (TraceErrorSource)
 void mode_trace_set_pid(int type, int value);
 
+// 运行时切换误差来源
+void mode_trace_set_error_source(TraceErrorSource source);
+TraceErrorSource mode_trace_get_error_source(void);
+
 #endif
@@ -0,0 +1,83 @@
+/**
+ ****************************************************************************************************
+ * @file        odometry.c
+ * @brief       差速底盘里程计实现
+ ****************************************************************************************************
+ */
+
+#include "odometry.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#define ODOMETRY_PI 3.14159265f
+
+/**
+ * @brief 角度归一化到 (-pi, pi]
+ */
+static float wrap_angle(float a) {
+  while (a > ODOMETRY_PI) a -= 2.0f * ODOMETRY_PI;
+  while (a <= -ODOMETRY_PI) a += 2.0f * ODOMETRY_PI;
+  return a;
+}
+
+void odometry_init(Odometry* odo, const OdometryConfig* cfg) {
+  if (odo == NULL || cfg == NULL) return;
+  odo->cfg = *cfg;
+  odo->primed = false;
+  odometry_reset_pose(odo);
+}
+
+void odometry_reset_pose(Odometry* odo) {
+  if (odo == NULL) return;
+  odo->pose.x_mm = 0.0f;
+  odo->pose.y_mm = 0.0f;
+  odo->pose.heading_rad = 0.0f;
+  odo->pose.heading_total_rad = 0.0f;
+  odo->pose.distance_mm = 0.0f;
+}
+
+void odometry_update(Odometry* odo, uint32_t count_left, uint32_t count_right,
+                     int dir_left, int dir_right) {
+  if (odo == NULL) return;
+  if (!odo->primed) {
+    odo->last_count[0] = count_left;
+    odo->last_count[1] = count_right;
+    odo->primed = true;
+    return;
+  }
+
+  // 无符号差值自动处理 32 位回绕
+  uint32_t dl_pulses = count_left - odo->last_count[0];
+  uint32_t dr_pulses = count_right - odo->last_count[1];
+  odo->last_count[0] = count_left;
+  odo->last_count[1] = count_right;
+  if (dl_pulses == 0 && dr_pulses == 0) return;
+
+  float dl = (float)dl_pulses * odo->cfg.mm_per_pulse;
+  float dr = (float)dr_pulses * odo->cfg.mm_per_pulse;
+  if (dir_left < 0) dl = -dl;
+  if (dir_right < 0) dr = -dr;
+
+  // 中点航向积分：先用半个转角更新方向再走直线，二阶精度
+  float ds = 0.5f * (dl + dr);
+  float dtheta = (dr - dl) / odo->cfg.track_mm;
+  float mid = odo->pose.heading_rad + 0.5f * dtheta;
+
+  odo->pose.x_mm += ds * cosf(mid);
+  odo->pose.y_mm += ds * sinf(mid);
+  odo->pose.heading_rad = wrap_angle(odo->pose.heading_rad + dtheta);
+  odo->pose.heading_total_rad += dtheta;
+  odo->pose.distance_mm += fabsf(ds);
+}
+
+float odometry_wheel_speed(const OdometryConfig* cfg, uint32_t period_us,
+                           uint64_t last_edge_us, uint64_t now_us) {
+  if (cfg == NULL || period_us == 0 || last_edge_us == 0) return 0.0f;
+
+  uint64_t since = now_us - last_edge_us;
+  if (since > ODOMETRY_SPEED_TIMEOUT_US) return 0.0f;
+
+  uint64_t eff = since > period_us ? since : period_us;
+  return cfg->mm_per_pulse * 1000000.0f / (float)eff;
+}
@@ -0,0 +1,83 @@
+/**
+ ****************************************************************************************************
+ * @file        odometry.h
+ * @brief       差速底盘里程计
+ * @details     输入两轮累计脉冲数和转向，按中点航向积分位姿 (x, y, heading)；
+ *              另提供按脉冲间隔估计轮速的函数。纯计算模块，不访问硬件，
+ *              可在主机上用合成的脉冲序列验证。
+ ****************************************************************************************************
+ */
+
+#ifndef ODOMETRY_H
+#define ODOMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ODOMETRY_SPEED_TIMEOUT_US 300000  // 超过该时间无脉冲视为轮子静止
+
+/**
+ * @brief 底盘几何参数
+ */
+typedef struct {
+  float mm_per_pulse;  // 每个脉冲对应的轮缘行程 (mm)
+  float track_mm;      // 两轮中心距 (mm)
+} OdometryConfig;
+
+/**
+ * @brief 位姿（起点为原点，初始朝向为 x 轴正方向）
+ */
+typedef struct {
+  float x_mm;               // 位置 x (mm)
+  float y_mm;               // 位置 y (mm)
+  float heading_rad;        // 航向，归一化到 (-pi, pi]，逆时针为正
+  float heading_total_rad;  // 累计转角（不归一化），用于按角度转向
+  float distance_mm;        // 中心点累计行驶路程（前进后退均累加）
+} OdometryPose;
+
+/**
+ * @brief 里程计状态
+ */
+typedef struct {
+  OdometryConfig cfg;
+  uint32_t last_count[2];  // 上次输入的左 / 右累计脉冲数
+  bool primed;             // 是否已有上次输入
+  OdometryPose pose;
+} Odometry;
+
+/**
+ * @brief 按几何参数初始化并清零位姿
+ */
+void odometry_init(Odometry* odo, const OdometryConfig* cfg);
+
+/**
+ * @brief 位姿归零（保留几何参数和计数基准）
+ */
+void odometry_reset_pose(Odometry* odo);
+
+/**
+ * @brief 输入一次两轮累计脉冲数并积分位姿
+ * @param odo 里程计
+ * @param count_left 左轮累计脉冲数（32 位循环）
+ * @param count_right 右轮累计脉冲数（32 位循环）
+ * @param dir_left 左轮转向：1 前进，-1 后退，0 视为前进
+ * @param dir_right 右轮转向
+ * @note 首次调用只记录计数基准
+ */
+void odometry_update(Odometry* odo, uint32_t count_left, uint32_t count_right,
+                     int dir_left, int dir_right);
+
+/**
+ * @brief 按脉冲间隔估计轮速大小
+ * @param cfg 几何参数
+ * @param period_us 最近两个脉冲的间隔，0 表示未知
+ * @param last_edge_us 最近一个脉冲的时刻，0 表示从未收到
+ * @param now_us 当前时刻
+ * @return 轮速 (mm/s)，不带方向
+ * @note 取脉冲间隔和"距上个脉冲已过去的时间"中的较大者，
+ *       轮子停转时速度随时间平滑衰减到 0，而不是停留在最后一个值
+ */
+float odometry_wheel_speed(const OdometryConfig* cfg, uint32_t period_us,
+                           uint64_t last_edge_us, uint64_t now_us);
+
+#endif /* ODOMETRY_H */
@@ -0,0 +1,242 @@
+/**
+ ****************************************************************************************************
+ * @file        pid_ctrl.c
+ * @brief       通用 PID 控制器实现
+ ****************************************************************************************************
+ */
+
+#include "pid_ctrl.h"
+
+#include <stddef.h>
+
+#include "securec.h"
+
+#define PID_US_PER_S 1000000
+#define PID_TWO_PI 6.2831853f
+
+/* ==================== 后端运算原语 ==================== */
+
+#if PID_USE_FIXED_POINT
+static inline pid_value_t pid_sat32(int64_t v) {
+  if (v > INT32_MAX) return INT32_MAX;
+  if (v < INT32_MIN) return INT32_MIN;
+  return (pid_value_t)v;
+}
+
+// a + b、a - b：各项单独饱和后相加仍可能溢出 int32，在 64 位下求和再饱和
+static inline pid_value_t pid_add(pid_value_t a, pid_value_t b) {
+  return pid_sat32((int64_t)a + b);
+}
+
+static inline pid_value_t pid_sub(pid_value_t a, pid_value_t b) {
+  return pid_sat32((int64_t)a - b);
+}
+
+static inline pid_value_t pid_sum4(pid_value_t a, pid_value_t b,
+                                   pid_value_t c, pid_value_t d) {
+  return pid_sat32((int64_t)a + b + c + d);
+}
+
+// a * b
+static inline pid_value_t pid_mul(pid_value_t a, pid_value_t b) {
+  return pid_sat32(((int64_t)a * b) >> 16);
+}
+
+// x * dt
+static inline pid_value_t pid_scale_dt(pid_value_t x, uint32_t dt_us) {
+  return pid_sat32(((int64_t)x * dt_us) / PID_US_PER_S);
+}
+
+// x / dt
+static inline pid_value_t pid_per_dt(pid_value_t x, uint32_t dt_us) {
+  return pid_sat32(((int64_t)x * PID_US_PER_S) / dt_us);
+}
+
+// 一阶低通系数 alpha = dt / (RC + dt)
+static inline pid_value_t pid_lpf_alpha(uint32_t rc_us, uint32_t dt_us) {
+  return (pid_value_t)(((int64_t)dt_us << 16) / ((int64_t)rc_us + dt_us));
+}
+
+// k * x * dt，保留 Q32 精度（先分出整秒部分，避免 64 位溢出）
+static inline pid_accum_t pid_integrate(pid_value_t k, pid_value_t x,
+                                        uint32_t dt_us) {
+  int64_t kx = (int64_t)k * x;  // Q32
+  return (kx / PID_US_PER_S) * dt_us +
+         (kx % PID_US_PER_S) * dt_us / PID_US_PER_S;
+}
+
+static inline pid_accum_t pid_acc_from(pid_value_t v) {
+  return (pid_accum_t)v * PID_Q16_ONE;
+}
+
+static inline pid_value_t pid_acc_to(pid_accum_t a) {
+  return pid_sat32(a / PID_Q16_ONE);
+}
+#else
+static inline pid_value_t pid_add(pid_value_t a, pid_value_t b) {
+  return a + b;
+}
+
+static inline pid_value_t pid_sub(pid_value_t a, pid_value_t b) {
+  return a - b;
+}
+
+static inline pid_value_t pid_sum4(pid_value_t a, pid_value_t b,
+                                   pid_value_t c, pid_value_t d) {
+  return a + b + c + d;
+}
+
+static inline pid_value_t pid_mul(pid_value_t a, pid_value_t b) {
+  return a * b;
+}
+
+static inline pid_value_t pid_scale_dt(pid_value_t x, uint32_t dt_us) {
+  return x * ((float)dt_us / (float)PID_US_PER_S);
+}
+
+static inline pid_value_t pid_per_dt(pid_value_t x, uint32_t dt_us) {
+  return x * ((float)PID_US_PER_S / (float)dt_us);
+}
+
+static inline pid_value_t pid_lpf_alpha(uint32_t rc_us, uint32_t dt_us) {
+  return (float)dt_us / (float)(rc_us + dt_us);
+}
+
+static inline pid_accum_t pid_integrate(pid_value_t k, pid_value_t x,
+                                        uint32_t dt_us) {
+  return k * x * ((float)dt_us / (float)PID_US_PER_S);
+}
+
+static inline pid_accum_t pid_acc_from(pid_value_t v) { return v; }
+
+static inline pid_value_t pid_acc_to(pid_accum_t a) { return a; }
+#endif
+
+static inline pid_value_t pid_clamp(pid_value_t v, pid_value_t lo,
+                                    pid_value_t hi) {
+  if (v > hi) return hi;
+  if (v < lo) return lo;
+  return v;
+}
+
+static inline pid_value_t pid_abs(pid_value_t v) { return v < 0 ? -v : v; }
+
+static inline pid_accum_t pid_acc_clamp(pid_accum_t v, pid_value_t limit) {
+  pid_accum_t hi = pid_acc_from(limit);
+  if (v > hi) return hi;
+  if (v < -hi) return -hi;
+  return v;
+}
+
+/* ==================== 对外接口 ==================== */
+
+void pid_init(PidCtrl* pid, const PidConfig* cfg) {
+  if (pid == NULL || cfg == NULL) return;
+
+  (void)memset_s(pid, sizeof(*pid), 0, sizeof(*pid));
+  pid->kff = PID_FROM_FLOAT(cfg->kff);
+  pid->out_min = PID_FROM_FLOAT(cfg->out_min);
+  pid->out_max = PID_FROM_FLOAT(cfg->out_max);
+
+  // 未指定积分限幅时取输出范围
+  float i_limit = cfg->i_limit;
+  if (i_limit <= 0.0f) {
+    float lo = cfg->out_min < 0.0f ? -cfg->out_min : cfg->out_min;
+    float hi = cfg->out_max < 0.0f ? -cfg->out_max : cfg->out_max;
+    i_limit = lo > hi ? lo : hi;
+  }
+  pid->i_limit = PID_FROM_FLOAT(i_limit);
+  pid->i_band = PID_FROM_FLOAT(cfg->i_band);
+  pid->slew_per_s = PID_FROM_FLOAT(cfg->slew_per_s);
+  pid->backcalc_gain = PID_FROM_FLOAT(cfg->backcalc_gain);
+  pid->anti_windup = cfg->anti_windup;
+
+  // RC = 1 / (2 * pi * fc)
+  pid->d_rc_us = 0;
+  if (cfg->d_cutoff_hz > 0.0f)
+    pid->d_rc_us = (uint32_t)((float)PID_US_PER_S /
+                              (PID_TWO_PI * cfg->d_cutoff_hz));
+
+  pid_set_gains(pid, cfg->kp, cfg->ki, cfg->kd);
+}
+
+void pid_set_gains(PidCtrl* pid, float kp, float ki, float kd) {
+  if (pid == NULL) return;
+  pid->kp = PID_FROM_FLOAT(kp);
+  pid->ki = PID_FROM_FLOAT(ki);
+  pid->kd = PID_FROM_FLOAT(kd);
+}
+
+void pid_reset(PidCtrl* pid) {
+  if (pid == NULL) return;
+  pid->integral = 0;
+  pid->d_filtered = 0;
+  pid->last_error = 0;
+  pid->last_output = 0;
+  pid->primed = false;
+  pid->p_term = pid->i_term = pid->d_term = pid->ff_term = 0;
+}
+
+pid_value_t pid_update(PidCtrl* pid, pid_value_t error, pid_value_t feedforward,
+                       uint32_t dt_us) {
+  if (pid == NULL) return 0;
+  if (dt_us == 0) dt_us = 1;
+
+  // 1. 比例项与前馈项
+  pid_value_t p = pid_mul(pid->kp, error);
+  pid_value_t ff = pid_mul(pid->kff, feedforward);
+
+  // 2. 微分项：对误差求导后做一阶低通，首拍不计算
+  if (pid->primed) {
+    pid_value_t d_raw = pid_per_dt(pid_sub(error, pid->last_error), dt_us);
+    if (pid->d_rc_us != 0) {
+      pid_value_t alpha = pid_lpf_alpha(pid->d_rc_us, dt_us);
+      pid->d_filtered =
+          pid_add(pid->d_filtered,
+                  pid_mul(alpha, pid_sub(d_raw, pid->d_filtered)));
+    } else {
+      pid->d_filtered = d_raw;
+    }
+  }
+  pid_value_t d = pid_mul(pid->kd, pid->d_filtered);
+
+  // 3. 积分项：按实际 dt 积分，在累加器精度下累加 Ki * e * dt
+  if (pid->i_band != 0 && pid_abs(error) > pid->i_band) {
+    pid->integral = 0;  // 积分分离：大误差时不积分
+  } else {
+    pid_accum_t di = pid_integrate(pid->ki, error, dt_us);
+    if (pid->anti_windup == PID_AW_CONDITIONAL) {
+      pid_value_t trial = pid_sum4(p, pid_acc_to(pid->integral + di), d, ff);
+      if ((trial > pid->out_max && di > 0) || (trial < pid->out_min && di < 0))
+        di = 0;  // 输出已饱和且继续同向积分，停止累加
+    }
+    pid->integral = pid_acc_clamp(pid->integral + di, pid->i_limit);
+  }
+  pid_value_t i = pid_acc_to(pid->integral);
+
+  // 4. 求和并限幅
+  pid_value_t raw = pid_sum4(p, i, d, ff);
+  pid_value_t out = pid_clamp(raw, pid->out_min, pid->out_max);
+
+  if (pid->anti_windup == PID_AW_BACKCALC && out != raw) {
+    pid_accum_t back =
+        pid_integrate(pid->backcalc_gain, pid_sub(out, raw), dt_us);
+    pid->integral = pid_acc_clamp(pid->integral + back, pid->i_limit);
+  }
+
+  // 5. 输出斜率限制
+  if (pid->slew_per_s != 0 && pid->primed) {
+    pid_value_t step = pid_scale_dt(pid->slew_per_s, dt_us);
+    out = pid_clamp(out, pid_sub(pid->last_output, step),
+                    pid_add(pid->last_output, step));
+  }
+
+  pid->p_term = p;
+  pid->i_term = pid_acc_to(pid->integral);
+  pid->d_term = d;
+  pid->ff_term = ff;
+  pid->last_error = error;
+  pid->last_output = out;
+  pid->primed = true;
+  return out;
+}
@@ -0,0 +1,113 @@
+/**
+ ****************************************************************************************************
+ * @file        pid_ctrl.h
+ * @brief       通用 PID 控制器（定点 / 浮点后端编译期可选）
+ * @details     支持按实际 dt 积分、条件积分 / 反算两种抗积分饱和、
+ *              微分一阶低通滤波、输出斜率限制和速度前馈。
+ *              PID_USE_FIXED_POINT=1 时内部运算全部为 Q16.16 整数，
+ *              每周期耗时确定，积分累加器为 Q32.32，小 Ki / 小误差的
+ *              增量不会被逐拍截断；=0 时使用单精度浮点。
+ ****************************************************************************************************
+ */
+
+#ifndef PID_CTRL_H
+#define PID_CTRL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef PID_USE_FIXED_POINT
+#define PID_USE_FIXED_POINT 1  // 1=Q16.16 定点, 0=float
+#endif
+
+#if PID_USE_FIXED_POINT
+typedef int32_t pid_value_t;  // Q16.16
+typedef int64_t pid_accum_t;  // Q32.32，积分累加器
+#define PID_Q16_ONE 65536
+#define PID_FROM_FLOAT(x) ((pid_value_t)((x) * (float)PID_Q16_ONE))
+#define PID_TO_FLOAT(v) ((float)(v) / (float)PID_Q16_ONE)
+#define PID_FROM_INT(x) ((pid_value_t)((int32_t)(x) * PID_Q16_ONE))
+#else
+typedef float pid_value_t;
+typedef float pid_accum_t;
+#define PID_FROM_FLOAT(x) ((pid_value_t)(x))
+#define PID_TO_FLOAT(v) ((float)(v))
+#define PID_FROM_INT(x) ((pid_value_t)(x))
+#endif
+
+/**
+ * @brief 抗积分饱和策略
+ */
+typedef enum {
+  PID_AW_NONE = 0,     // 仅积分限幅
+  PID_AW_CONDITIONAL,  // 条件积分：输出饱和且误差同向时停止积分
+  PID_AW_BACKCALC      // 反算：按饱和量回拉积分项
+} PidAntiWindup;
+
+/**
+ * @brief PID 配置（浮点描述，初始化时转换为后端格式）
+ */
+typedef struct {
+  float kp;              // 比例系数
+  float ki;              // 积分系数 (1/s)
+  float kd;              // 微分系数 (s)
+  float kff;             // 前馈系数
+  float out_min;         // 输出下限
+  float out_max;         // 输出上限
+  float i_limit;         // 积分项绝对值上限（输出单位），0 表示取输出范围
+  float i_band;          // 积分分离带：|误差| 超过该值时清零积分，0 表示不启用
+  float d_cutoff_hz;     // 微分低通截止频率，0 表示不滤波
+  float slew_per_s;      // 输出最大变化率（单位/秒），0 表示不限制
+  float backcalc_gain;   // 反算增益 (1/s)，仅 PID_AW_BACKCALC 使用
+  PidAntiWindup anti_windup;
+} PidConfig;
+
+/**
+ * @brief PID 运行时状态
+ */
+typedef struct {
+  pid_value_t kp, ki, kd, kff;
+  pid_value_t out_min, out_max;
+  pid_value_t i_limit;
+  pid_value_t i_band;
+  pid_value_t slew_per_s;
+  pid_value_t backcalc_gain;
+  uint32_t d_rc_us;  // 微分滤波时间常数 (us)，0 表示不滤波
+  PidAntiWindup anti_windup;
+
+  pid_accum_t integral;    // 积分项（已乘 Ki，输出单位，定点为 Q32.32）
+  pid_value_t d_filtered;  // 滤波后的误差导数
+  pid_value_t last_error;
+  pid_value_t last_output;
+  bool primed;  // 是否已有上一拍数据（首拍不计算微分和斜率）
+
+  pid_value_t p_term, i_term, d_term, ff_term;  // 最近一次各项输出
+} PidCtrl;
+
+/**
+ * @brief 按配置初始化控制器并清零状态
+ */
+void pid_init(PidCtrl* pid, const PidConfig* cfg);
+
+/**
+ * @brief 运行时修改 Kp/Ki/Kd（保留其余配置）
+ */
+void pid_set_gains(PidCtrl* pid, float kp, float ki, float kd);
+
+/**
+ * @brief 清零积分、微分和斜率历史
+ */
+void pid_reset(PidCtrl* pid);
+
+/**
+ * @brief 计算一拍 PID 输出
+ * @param pid 控制器
+ * @param error 误差（设定值 - 测量值）
+ * @param feedforward 前馈参考量（如目标速度），乘以 kff 后叠加
+ * @param dt_us 距上一拍的实际时间 (us)
+ * @return 限幅、限斜率后的输出
+ */
+pid_value_t pid_update(PidCtrl* pid, pid_value_t error, pid_value_t feedforward,
+                       uint32_t dt_us);
+
+#endif /* PID_CTRL_H */
@@ -0,0 +1,134 @@
+/**
+ ****************************************************************************************************
+ * @file        polar_map.c
+ * @brief       极坐标障碍直方图实现
+ ****************************************************************************************************
+ */
+
+#include "polar_map.h"
+
+#include <stddef.h>
+
+void polar_map_init(PolarMap* map, const PolarMapConfig* cfg) {
+  if (map == NULL || cfg == NULL) return;
+  map->cfg = *cfg;
+  if (map->cfg.sectors < 2) map->cfg.sectors = 2;
+  if (map->cfg.sectors > POLAR_MAP_MAX_SECTORS)
+    map->cfg.sectors = POLAR_MAP_MAX_SECTORS;
+  if (map->cfg.wide_sectors < 1) map->cfg.wide_sectors = 1;
+
+  for (int i = 0; i < POLAR_MAP_MAX_SECTORS; i++) {
+    map->sector[i].distance_cm = map->cfg.range_cm;
+    map->sector[i].certainty = 0;
+    map->sector[i].measured = false;
+    map->density[i] = 0.0f;
+  }
+}
+
+float polar_map_sector_angle(const PolarMap* map, int idx) {
+  float step = map->cfg.fov_deg / (float)(map->cfg.sectors - 1);
+  return -0.5f * map->cfg.fov_deg + step * (float)idx;
+}
+
+void polar_map_update(PolarMap* map, int idx, float distance_cm,
+                      SonarInput input) {
+  if (map == NULL || idx < 0 || idx >= map->cfg.sectors) return;
+  PolarSector* s = &map->sector[idx];
+  s->measured = true;
+
+  if (input == SONAR_INPUT_NONE) {
+    // 距离未知：确定度不变，距离不超过 unknown_cm，选中时只能减速通过
+    if (s->distance_cm > map->cfg.unknown_cm)
+      s->distance_cm = map->cfg.unknown_cm;
+    return;
+  }
+
+  if (input == SONAR_INPUT_NEAR) distance_cm = 0.0f;
+  if (distance_cm > map->cfg.range_cm) distance_cm = map->cfg.range_cm;
+  s->distance_cm = distance_cm;
+
+  if (distance_cm < map->cfg.range_cm) {
+    if (s->certainty < map->cfg.cv_max) s->certainty++;
+  } else if (s->certainty > 0) {
+    s->certainty--;
+  }
+}
+
+bool polar_map_ready(const PolarMap* map) {
+  for (int i = 0; i < map->cfg.sectors; i++)
+    if (!map->sector[i].measured) return false;
+  return true;
+}
+
+/**
+ * @brief 单个扇区的原始障碍密度
+ */
+static float sector_density(const PolarMap* map, int idx) {
+  const PolarSector* s = &map->sector[idx];
+  float closeness = 1.0f - s->distance_cm / map->cfg.range_cm;
+  if (closeness <= 0.0f) return 0.0f;
+  float cv = (float)s->certainty;
+  return cv * cv * closeness;
+}
+
+bool polar_map_select(PolarMap* map, float target_deg, PolarSteer* out) {
+  int n = map->cfg.sectors;
+  float raw[POLAR_MAP_MAX_SECTORS];
+  for (int i = 0; i < n; i++) raw[i] = sector_density(map, i);
+
+  // (1, 2, 1) 平滑，边界扇区复制自身
+  for (int i = 0; i < n; i++) {
+    float l = raw[i > 0 ? i - 1 : i];
+    float r = raw[i < n - 1 ? i + 1 : i];
+    map->density[i] = 0.25f * (l + 2.0f * raw[i] + r);
+  }
+
+  // 期望方向换算为扇区下标（可为小数）
+  float step = map->cfg.fov_deg / (float)(n - 1);
+  float target_idx = (target_deg + 0.5f * map->cfg.fov_deg) / step;
+
+  // 找最宽的谷，等宽时取离期望方向最近的
+  int best_start = -1, best_len = 0;
+  float best_dist = 0.0f;
+  for (int i = 0; i < n;) {
+    if (map->density[i] >= map->cfg.threshold) {
+      i++;
+      continue;
+    }
+    int start = i;
+    while (i < n && map->density[i] < map->cfg.threshold) i++;
+    int len = i - start;
+    float center = start + 0.5f * (float)(len - 1);
+    float dist = center > target_idx ? center - target_idx : target_idx - center;
+    if (len > best_len || (len == best_len && dist < best_dist)) {
+      best_start = start;
+      best_len = len;
+      best_dist = dist;
+    }
+  }
+
+  out->found = best_len > 0;
+  out->width = (uint8_t)best_len;
+  if (!out->found) {
+    out->angle_deg = 0.0f;
+    out->clearance_cm = 0.0f;
+    return false;
+  }
+
+  // 窄谷走正中；宽谷在与两侧谷边各留半个门限的范围内尽量靠近期望方向
+  float lo = (float)best_start;
+  float hi = (float)(best_start + best_len - 1);
+  float chosen;
+  if (best_len >= map->cfg.wide_sectors) {
+    float margin = 0.5f * (float)(map->cfg.wide_sectors - 1);
+    float a = lo + margin, b = hi - margin;
+    chosen = target_idx < a ? a : (target_idx > b ? b : target_idx);
+  } else {
+    chosen = 0.5f * (lo + hi);
+  }
+
+  int nearest = (int)(chosen + 0.5f);
+  out->angle_deg = -0.5f * map->cfg.fov_deg + step * chosen;
+  out->clearance_cm = map->sector[nearest].distance_cm;
+  return true;
+}
@@ -0,0 +1,102 @@
+/**
+ ****************************************************************************************************
+ * @file        polar_map.h
+ * @brief       舵机扫描超声波的极坐标障碍直方图（VFH 风格）
+ * @details     扫描范围均分为若干扇区，每个扇区保存最近一次距离和确定度：
+ *              测到关注距离内的障碍时确定度加 1，否则减 1。选向时按
+ *              确定度^2 * (1 - 距离 / 关注距离) 计算障碍密度，相邻扇区
+ *              (1, 2, 1) 平滑后低于阈值的连续扇区构成"谷"，取最宽的谷，
+ *              宽谷内取离目标方向最近且与谷边保持半个宽谷门限的位置。
+ *              扇区按车体坐标定义，角度左正右负。纯计算模块，不访问硬件。
+ ****************************************************************************************************
+ */
+
+#ifndef POLAR_MAP_H
+#define POLAR_MAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sonar_filter.h"
+
+#define POLAR_MAP_MAX_SECTORS 16  // 扇区数上限
+
+/**
+ * @brief 直方图配置
+ */
+typedef struct {
+  uint8_t sectors;       // 扇区数 (2 ~ POLAR_MAP_MAX_SECTORS)
+  float fov_deg;         // 扫描总角度，扇区中心均匀分布在 [-fov/2, fov/2]
+  float range_cm;        // 关注距离：更远的回波不计入障碍密度
+  uint8_t cv_max;        // 确定度上限
+  float threshold;       // 平滑后密度低于该值视为可通行
+  uint8_t wide_sectors;  // 宽谷门限：不少于该扇区数的谷不必走正中
+  float unknown_cm;      // 无回波扇区的距离上限：未知按近处处理，只许减速通过
+} PolarMapConfig;
+
+/**
+ * @brief 单个扇区
+ */
+typedef struct {
+  float distance_cm;  // 最近一次距离，无回波时不超过 unknown_cm
+  uint8_t certainty;  // 障碍确定度 (0 ~ cv_max)
+  bool measured;      // 是否测量过
+} PolarSector;
+
+/**
+ * @brief 直方图状态
+ */
+typedef struct {
+  PolarMapConfig cfg;
+  PolarSector sector[POLAR_MAP_MAX_SECTORS];
+  float density[POLAR_MAP_MAX_SECTORS];  // 平滑后障碍密度（最近一次选向时计算）
+} PolarMap;
+
+/**
+ * @brief 选向结果
+ */
+typedef struct {
+  bool found;          // 是否存在可通行的谷
+  float angle_deg;     // 建议方向（车体坐标，左正右负）
+  uint8_t width;       // 所选谷的扇区数
+  float clearance_cm;  // 建议方向所在扇区的距离
+} PolarSteer;
+
+/**
+ * @brief 按配置初始化并清空直方图
+ */
+void polar_map_init(PolarMap* map, const PolarMapConfig* cfg);
+
+/**
+ * @brief 获取扇区中心角度
+ * @param idx 扇区下标，0 为最右侧
+ * @return 角度 (deg)，左正右负
+ */
+float polar_map_sector_angle(const PolarMap* map, int idx);
+
+/**
+ * @brief 输入一次扇区测距结果
+ * @param map 直方图
+ * @param idx 扇区下标
+ * @param distance_cm 距离 (cm)，仅 SONAR_INPUT_ECHO 时有意义
+ * @param input 测距结果分类：过近按 0cm 受阻；无回波保持原确定度，
+ *              距离取原值与 unknown_cm 的较小者（不按开阔处理）
+ */
+void polar_map_update(PolarMap* map, int idx, float distance_cm,
+                      SonarInput input);
+
+/**
+ * @brief 是否所有扇区都已测量过（完成首轮扫描）
+ */
+bool polar_map_ready(const PolarMap* map);
+
+/**
+ * @brief 计算障碍密度并选择行驶方向
+ * @param map 直方图
+ * @param target_deg 期望方向（车体坐标）
+ * @param out 选向结果
+ * @return out->found
+ */
+bool polar_map_select(PolarMap* map, float target_deg, PolarSteer* out);
+
+#endif /* POLAR_MAP_H */
@@ -20,6 +20,35 @@
 #define LOOP_DELAY 20       // 主循环延时
 #define STANDBY_DELAY 500   // 待机更新间隔
 
+/* 控制调度配置（见 control_sched.h） */
+#define CONTROL_SCHED_TIMER_INDEX 1  // 硬件定时器编号（TIMER1 已由系统适配）
+#define CONTROL_BASE_HZ 200          // 调度基准频率
+#define CONTROL_LOOP_HZ 200          // 控制组：模式状态机
+#define SERVICE_LOOP_HZ 50           // 服务组：喂狗
+#define DIAG_LOOP_HZ 1               // 诊断组：调度统计
+#define NET_DIAG_PERIOD_S 10         // 诊断组：网络统计打印周期 (s)
+
+/* 传感器配置 */
+#define SONAR_PERIOD_MS 60         // 超声波连续测距周期
+#define SONAR_STALE_MS 200         // 超过该时间无新结果视为测距失效
+#define SONAR_TEMP_PERIOD_MS 5000  // 声速温度修正的更新周期
+#define SONAR_DIE_TEMP_OFFSET_C 0  // 片上温度高于环境温度的偏差，修正时扣除
+#define IR_SCAN_PERIOD_MS 5        // 红外循迹后台采集间隔
+#define IR_OVERSAMPLE 2            // 红外循迹每路每组过采样次数（忙等约 300us）
+
+/* 底盘与速度环配置（见 drive_ctrl.h） */
+#define WHEEL_DIAMETER_MM 65.0f      // 车轮直径
+#define WHEEL_TRACK_MM 130.0f        // 两轮中心距
+#define DRIVE_MAX_SPEED_MM_S 500.0f  // 占空比 100% 对应的轮速，前馈按此换算
+#define DRIVE_KP 0.05f               // 速度环比例系数 (%/(mm/s))
+#define DRIVE_KI 0.5f                // 速度环积分系数 (%/(mm/s)/s)
+#define DRIVE_MAX_DT_US 50000        // 两拍间隔上限
+
+/* PID 参数存储约定 */
+// NV 中的 Ki/Kd 是按旧版每拍 (LOOP_DELAY) 整定的离散系数，
+// 使用时换算为连续时间系数：Ki = Ki_nv / dt，Kd = Kd_nv * dt
+#define PID_NV_DT_S (LOOP_DELAY / 1000.0f)
+
 /* 网络配置 */
 #define RECV_TIMEOUT 100          // 接收超时
 #define WIFI_RETRY_INTERVAL 5000  // WiFi 重试间隔
@@ -40,4 +69,7 @@
     if (inited) osal_mutex_unlock(&(mutex)); \
   } while (0)
 
+// 内存屏障：用于无锁数据结构的发布顺序
+#define ROBOT_MEMORY_BARRIER() __sync_synchronize()
+
 #endif /* ROBOT_CONFIG_H */
@@ -0,0 +1,75 @@
+/**
+ ****************************************************************************************************
+ * @file        robot_event.c
+ * @brief       中断安全的机器人事件队列实现
+ ****************************************************************************************************
+ */
+
+#include "robot_event.h"
+
+#include <stddef.h>
+
+#include "robot_config.h"
+#include "soc_osal.h"
+
+#define ROBOT_EVENT_MASK (ROBOT_EVENT_QUEUE_SIZE - 1u)
+
+/*
+ * 环形队列：head 只由生产者推进，tail 只由消费者推进
+ * - 内核 (rv32imc) 没有原子指令扩展，多个生产者之间用极短的关中断区
+ *   互斥：只做判满、拷贝一个事件、推进 head，不调用任何可能阻塞的接口
+ * - 单消费者（控制线程）不关中断：先读 head，屏障后读槽位，屏障后再
+ *   推进 tail，保证生产者看到 tail 前进时槽位已读完
+ */
+static RobotEvent g_queue[ROBOT_EVENT_QUEUE_SIZE];
+static volatile uint32_t g_head = 0;     /* 下一个写入位置（生产者） */
+static volatile uint32_t g_tail = 0;     /* 下一个读取位置（消费者） */
+static volatile uint32_t g_dropped = 0;  /* 队列满丢弃计数 */
+
+bool robot_event_post(const RobotEvent* evt) {
+  if (evt == NULL) return false;
+
+  bool ok = false;
+  unsigned int irq = osal_irq_lock();
+  uint32_t head = g_head;
+  if (head - g_tail < ROBOT_EVENT_QUEUE_SIZE) {
+    g_queue[head & ROBOT_EVENT_MASK] = *evt;
+    ROBOT_MEMORY_BARRIER();
+    g_head = head + 1u;
+    ok = true;
+  } else {
+    g_dropped++;
+  }
+  osal_irq_restore(irq);
+  return ok;
+}
+
+bool robot_event_post_mode(RobotEventSource source, int status) {
+  RobotEvent evt = {ROBOT_EVT_MODE, (uint8_t)source, (int16_t)status, 0};
+  return robot_event_post(&evt);
+}
+
+bool robot_event_post_pid(RobotEventSource source, int type, int value) {
+  RobotEvent evt = {ROBOT_EVT_PID, (uint8_t)source, (int16_t)type,
+                    (int16_t)value};
+  return robot_event_post(&evt);
+}
+
+bool robot_event_post_button(void) {
+  RobotEvent evt = {ROBOT_EVT_BUTTON, ROBOT_SRC_BUTTON, 0, 0};
+  return robot_event_post(&evt);
+}
+
+bool robot_event_pop(RobotEvent* out) {
+  if (out == NULL) return false;
+
+  uint32_t tail = g_tail;
+  if (tail == g_head) return false;
+  ROBOT_MEMORY_BARRIER();  // 先确认 head 再读槽位
+  *out = g_queue[tail & ROBOT_EVENT_MASK];
+  ROBOT_MEMORY_BARRIER();  // 槽位读完后再释放给生产者
+  g_tail = tail + 1u;
+  return true;
+}
+
+uint32_t robot_event_get_dropped(void) { return g_dropped; }
@@ -0,0 +1,73 @@
+/**
+ ****************************************************************************************************
+ * @file        robot_event.h
+ * @brief       中断安全的机器人事件队列（多生产者 / 单消费者）
+ * @details     按键中断、UDP 任务、SLE 回调、语音任务只投递事件，
+ *              由控制线程在每个周期开始时统一取出并执行，模式切换和
+ *              PID 修改都只在控制线程内生效（电机命令走 cmd_bus）。
+ *              投递为非阻塞操作，队列满时丢弃并计数。
+ ****************************************************************************************************
+ */
+
+#ifndef ROBOT_EVENT_H
+#define ROBOT_EVENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ROBOT_EVENT_QUEUE_SIZE 32  // 队列深度，必须为 2 的幂
+
+/**
+ * @brief 事件类型
+ */
+typedef enum {
+  ROBOT_EVT_MODE = 0,  // 模式切换：a = CarStatus
+  ROBOT_EVT_PID,       // PID 参数：a = 参数类型，b = 数值
+  ROBOT_EVT_BUTTON     // 模式按键按下
+} RobotEventType;
+
+/**
+ * @brief 事件来源（遥控命令按来源区分优先级）
+ */
+typedef enum {
+  ROBOT_SRC_LOCAL = 0,  // 控制线程内部
+  ROBOT_SRC_BUTTON,     // 板载按键
+  ROBOT_SRC_UDP,        // WiFi UDP
+  ROBOT_SRC_SLE,        // 星闪 SLE
+  ROBOT_SRC_VOICE,      // 语音模块
+  ROBOT_SRC_NUM
+} RobotEventSource;
+
+/**
+ * @brief 事件（6 字节，按值拷贝进队列）
+ */
+typedef struct {
+  uint8_t type;    // RobotEventType
+  uint8_t source;  // RobotEventSource
+  int16_t a;
+  int16_t b;
+} RobotEvent;
+
+/**
+ * @brief 投递一个事件（任意线程 / 中断上下文可调用，不阻塞）
+ * @return true 成功，false 队列已满（事件被丢弃）
+ */
+bool robot_event_post(const RobotEvent* evt);
+
+// 便捷投递接口
+bool robot_event_post_mode(RobotEventSource source, int status);
+bool robot_event_post_pid(RobotEventSource source, int type, int value);
+bool robot_event_post_button(void);
+
+/**
+ * @brief 取出一个事件（仅控制线程调用）
+ * @return true 取到事件，false 队列为空
+ */
+bool robot_event_pop(RobotEvent* out);
+
+/**
+ * @brief 获取因队列满被丢弃的事件总数
+ */
+uint32_t robot_event_get_dropped(void);
+
+#endif /* ROBOT_EVENT_H */
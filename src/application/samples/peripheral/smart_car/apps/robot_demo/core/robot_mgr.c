@@ -5,38 +5,70 @@
 
 #include "../../../drivers/hcsr04/bsp_hcsr04.h"
 #include "../../../drivers/l9110s/bsp_l9110s.h"
+#include "../../../drivers/sg90/bsp_sg90.h"
 #include "../../../drivers/tcrt5000/bsp_tcrt5000.h"
+#include "../services/flight_recorder.h"
 #include "../services/sle_service.h"
 #include "../services/storage_service.h"
 #include "../services/udp_service.h"
 #include "../services/ui_service.h"
+#include "drive_ctrl.h"
+#include "mode_autotune.h"
+#include "mode_calib.h"
 #include "mode_obstacle.h"
 #include "mode_remote.h"
+#include "mode_scan.h"
 #include "mode_trace.h"
 #include "robot_config.h"
+#include "robot_event.h"
 #include "securec.h"
 #include "soc_osal.h"
+#include "sonar_filter.h"
+#include "tcxo.h"
+#include "tsensor.h"
+
+// 电机整形参数，与 PID 共用参数事件（UDP 0x04 包的参数类型）
+#define MOTOR_PARAM_ACCEL 6        // 加速斜率 (%/s)
+#define MOTOR_PARAM_DECEL 7        // 减速斜率 (%/s)
+#define MOTOR_PARAM_DEADBAND 8     // 死区补偿 (%)
+#define MOTOR_PARAM_TRIM_LEFT 9    // 左轮增益修正 (‰)
+#define MOTOR_PARAM_TRIM_RIGHT 10  // 右轮增益修正 (‰)
 
 static CarStatus g_status = CAR_STOP_STATUS; /* 当前小车运行模式 */
 static CarStatus g_last_status =
     CAR_STOP_STATUS; /* 上次小车运行模式（用于检测模式切换） */
+static unsigned long long g_button_tick = 0; /* 上次按键生效时刻（防抖） */
+
+static SonarFilter g_sonar_filter;            /* 超声波滤波管线 */
+static SonarEstimate g_sonar = {0};           /* 最近一次滤波输出 */
+static uint32_t g_sonar_seq = 0;              /* 已送入滤波的驱动结果序号 */
+static unsigned long long g_sonar_temp_tick;  /* 上次温度修正时刻 */
+static Tcrt5000SampleSet g_ir = {0};          /* 最近一组红外采样 */
 
-// 全局机器人状态（包含距离、传感器值等）
-static RobotState g_robot_state = {0};
+/*
+ * 机器人状态快照：单写者（控制线程）/ 多读者的双缓冲序列锁
+ * - 控制线程在 g_state_work 中累积本周期的更新，周期末整体发布到
+ *   未被发布的那个槽位，再切换发布索引
+ * - 读者只读已发布槽位，读前后序号一致即为一致快照，否则重试；
+ *   读者从不阻塞写者，写者也从不等待读者
+ */
+typedef struct {
+  volatile uint32_t seq;  // 槽位序号：奇数表示正在写入
+  RobotState state;
+} RobotStateSlot;
 
-// 互斥锁：保护 机器人状态，防止多个线程同时读写
-static osal_mutex g_state_mutex;
-// 互斥锁是否已初始化的标志（初始化成功后设为 true）
-static bool g_state_mutex_inited = false;
+static RobotState g_state_work = {0};      /* 控制线程私有的工作副本 */
+static RobotStateSlot g_state_slots[2];    /* 发布槽位 */
+static volatile uint32_t g_state_pub = 0;  /* 当前发布的槽位索引 */
 
 static void mode_standby_enter(void) {
   // 切换到待机模式时，立即停止小车
-  CAR_STOP();
+  drive_ctrl_stop();
 }
 
 /**
  * @brief 待机模式周期回调函数
- * @note 每 500ms 更新一次 OLED 显示，展示 WiFi 连接状态和 IP 地址
+ * @note 每 500ms 检查一次 WiFi 连接状态和 IP 地址，内容变化时才重绘 OLED
  */
 static void mode_standby_tick(void) {
   static unsigned long long last_ui_update = 0;  // 上次 UI 更新时间戳
@@ -70,18 +102,36 @@ static RobotModeOps g_mode_ops[] = {
     // CAR_OBSTACLE_AVOIDANCE_STATUS (2)
     {mode_obstacle_enter, mode_obstacle_tick, mode_obstacle_exit},
     // CAR_WIFI_CONTROL_STATUS (3)
-    {mode_remote_enter, mode_remote_tick, mode_remote_exit}};
+    {mode_remote_enter, mode_remote_tick, mode_remote_exit},
+    // CAR_BT_CONTROL_STATUS (4)：未实现，保持静止
+    {NULL, NULL, NULL},
+    // CAR_CALIBRATE_STATUS (5)
+    {mode_calib_enter, mode_calib_tick, mode_calib_exit},
+    // CAR_AUTOTUNE_STATUS (6)
+    {mode_autotune_enter, mode_autotune_tick, mode_autotune_exit},
+    // CAR_SCAN_AVOID_STATUS (7)
+    {mode_scan_enter, mode_scan_tick, mode_scan_exit}};
 
 /**
- * @brief 初始化状态互斥锁，保护全局机器人状态的并发访问
+ * @brief 发布工作副本为新的状态快照（仅控制线程调用）
  */
-static void robot_mgr_state_mutex_init(void) {
-  if (g_state_mutex_inited) return;
+static void robot_mgr_publish_state(void) {
+  l9110s_get_differential(&g_state_work.duty_left, &g_state_work.duty_right);
+  g_state_work.mode = g_last_status;
+  g_state_work.timestamp_us = uapi_tcxo_get_us();
+  g_state_work.seq++;
+  flight_recorder_log(&g_state_work);
 
-  if (osal_mutex_init(&g_state_mutex) == OSAL_SUCCESS)
-    g_state_mutex_inited = true;
-  else
-    printf("RobotMgr: 状态互斥锁初始化失败\r\n");
+  uint32_t idx = g_state_pub ^ 1u;
+  RobotStateSlot* slot = &g_state_slots[idx];
+
+  slot->seq++;  // 奇数：写入中
+  ROBOT_MEMORY_BARRIER();
+  slot->state = g_state_work;
+  ROBOT_MEMORY_BARRIER();
+  slot->seq++;  // 偶数：写入完成
+  ROBOT_MEMORY_BARRIER();
+  g_state_pub = idx;
 }
 
 /**
@@ -93,15 +143,31 @@ void robot_mgr_init(void) {
   storage_service_init();
 
   l9110s_init();
+  L9110sShaping motor_shaping;
+  if (storage_service_get_motor_shaping(&motor_shaping))
+    l9110s_set_shaping(&motor_shaping);
+  drive_ctrl_init();
   hcsr04_init();
-  tcrt5000_adc_init();  // 使用ADC模式初始化TCRT5000
+  (void)hcsr04_start_ranging(SONAR_PERIOD_MS);  // 后台连续测距，不占用控制线程
+  (void)sg90_init();  // 超声波云台舵机，回正后仅扫描避障模式转动
+  SonarFilterConfig sonar_cfg;
+  sonar_filter_default_config(&sonar_cfg);
+  sonar_filter_init(&g_sonar_filter, &sonar_cfg);
+  // 使用ADC模式初始化TCRT5000，有标定数据时加载标定阈值
+  Tcrt5000Profile ir_profile;
+  bool ir_calibrated = storage_service_get_ir_profile(&ir_profile);
+  tcrt5000_adc_init_with_profile(ir_calibrated ? &ir_profile : NULL);
+  (void)tcrt5000_scan_start(IR_SCAN_PERIOD_MS, IR_OVERSAMPLE);  // 后台采集
+  if (ir_calibrated) mode_calib_apply_to_estimator(&ir_profile);
 
   ui_service_init();
   udp_service_init();
   sle_service_init();
-  robot_mgr_state_mutex_init();
-  robot_mgr_set_status(CAR_STOP_STATUS);
+  flight_recorder_init();
+  g_status = CAR_STOP_STATUS;
   g_last_status = CAR_STOP_STATUS;
+  ui_show_mode_page(CAR_STOP_STATUS);
+  robot_mgr_publish_state();
 
   printf("RobotMgr: 初始化完成\r\n");
 }
@@ -113,24 +179,168 @@ void robot_mgr_init(void) {
 CarStatus robot_mgr_get_status(void) { return g_status; }
 
 /**
- * @brief 设置小车状态并更新 UI 显示
+ * @brief 请求切换小车状态
  * @param status 新的状态值
+ * @note 任意线程 / 中断可调用：只投递事件，由控制线程在下个周期开始时生效
  */
 void robot_mgr_set_status(CarStatus status) {
+  if (!robot_event_post_mode(ROBOT_SRC_LOCAL, status))
+    printf("RobotMgr: 事件队列已满，模式切换 %d 被丢弃\r\n", status);
+}
+
+/**
+ * @brief 应用模式切换并更新 UI 显示（仅控制线程调用）
+ */
+static void robot_mgr_apply_status(CarStatus status) {
   if (g_status != status) {
-    g_status = status;
-    // 加锁保护状态更新
-    MUTEX_LOCK(g_state_mutex, g_state_mutex_inited);
-    g_robot_state.mode = status;
-    MUTEX_UNLOCK(g_state_mutex, g_state_mutex_inited);
+    g_status = status;  // 快照中的 mode 由控制线程在模式切换后发布
     ui_show_mode_page(status);
   }
 }
 
+/**
+ * @brief 按键：停止 -> 循迹 -> 避障 -> 遥控 -> 停止，其他模式下直接停止
+ */
+static void robot_mgr_on_button(void) {
+  unsigned long long now = osal_get_jiffies();
+  if ((now - g_button_tick) < osal_msecs_to_jiffies(200)) return;  // 防抖
+  g_button_tick = now;
+
+  // 按键只在前 4 个模式间循环；标定、自整定等其他模式下按键即中止并停车
+  static const char* mode_names[] = {"停止", "循迹", "避障", "遥控"};
+  const int cycle = (int)(sizeof(mode_names) / sizeof(mode_names[0]));
+  if ((int)g_status >= cycle) {
+    printf("模式切换：中止模式 %d -> 停止\r\n", (int)g_status);
+    robot_mgr_apply_status(CAR_STOP_STATUS);
+    return;
+  }
+
+  CarStatus next_status = (CarStatus)((g_status + 1) % cycle);
+  printf("模式切换：%s -> %s\r\n", mode_names[g_status],
+         mode_names[next_status]);
+  robot_mgr_apply_status(next_status);
+}
+
+/**
+ * @brief 修改一项电机整形参数并写 NV（仅控制线程调用）
+ * @param type MOTOR_PARAM_*
+ * @param value 参数值
+ */
+static void robot_mgr_set_motor_param(int type, int value) {
+  L9110sShaping sh;
+  l9110s_get_shaping(&sh);
+  uint16_t rate = value < 0 ? 0 : (uint16_t)value;
+
+  if (type == MOTOR_PARAM_ACCEL)
+    sh.accel_pct_s = rate;
+  else if (type == MOTOR_PARAM_DECEL)
+    sh.decel_pct_s = rate;
+  else if (type == MOTOR_PARAM_DEADBAND)
+    sh.deadband_pct = rate > UINT8_MAX ? UINT8_MAX : (uint8_t)rate;
+  else if (type == MOTOR_PARAM_TRIM_LEFT)
+    sh.trim_permille[0] = (int16_t)value;
+  else if (type == MOTOR_PARAM_TRIM_RIGHT)
+    sh.trim_permille[1] = (int16_t)value;
+  else
+    return;
+
+  l9110s_set_shaping(&sh);
+  l9110s_get_shaping(&sh);  // 保存截断后的值
+  printf("[电机] 整形: 加速=%u%%/s 减速=%u%%/s 死区=%u%% 修正 左=%d 右=%d\r\n",
+         sh.accel_pct_s, sh.decel_pct_s, sh.deadband_pct, sh.trim_permille[0],
+         sh.trim_permille[1]);
+  (void)storage_service_save_motor_shaping(&sh);
+}
+
+/**
+ * @brief 执行一个事件（仅控制线程调用）
+ */
+static void robot_mgr_handle_event(const RobotEvent* evt) {
+  switch (evt->type) {
+    case ROBOT_EVT_MODE:
+      if (evt->a >= CAR_STOP_STATUS && evt->a <= CAR_SCAN_AVOID_STATUS)
+        robot_mgr_apply_status((CarStatus)evt->a);
+      break;
+    case ROBOT_EVT_PID:
+      if (evt->a >= MOTOR_PARAM_ACCEL)
+        robot_mgr_set_motor_param(evt->a, evt->b);
+      else
+        mode_trace_set_pid(evt->a, evt->b);
+      break;
+    case ROBOT_EVT_BUTTON:
+      robot_mgr_on_button();
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief 超声波：声速温度修正 + 新结果送入滤波管线（仅控制线程调用）
+ */
+static void robot_mgr_update_sonar(void) {
+  unsigned long long now = osal_get_jiffies();
+  if (g_sonar_temp_tick == 0 ||
+      now - g_sonar_temp_tick >= osal_msecs_to_jiffies(SONAR_TEMP_PERIOD_MS)) {
+    int8_t temp = 0;
+    if (uapi_tsensor_get_current_temp(&temp) == ERRCODE_SUCC)
+      hcsr04_set_temperature((float)(temp - SONAR_DIE_TEMP_OFFSET_C));
+    g_sonar_temp_tick = now;
+  }
+
+  Hcsr04Reading reading;
+  if (!hcsr04_get_latest(&reading) || reading.seq == g_sonar_seq) return;
+  g_sonar_seq = reading.seq;
+
+  SonarInput input = SONAR_INPUT_ECHO;
+  if (!reading.valid)
+    input = hcsr04_reading_too_close(&reading) ? SONAR_INPUT_NEAR
+                                               : SONAR_INPUT_NONE;
+  sonar_filter_update(&g_sonar_filter, reading.distance_cm, input,
+                      reading.timestamp_us, &g_sonar);
+  robot_mgr_update_distance(g_sonar.valid ? g_sonar.distance_cm : 0.0f);
+}
+
+/**
+ * @brief 获取滤波后的超声波估计
+ * @note 仅控制线程调用
+ */
+void robot_mgr_get_sonar(SonarEstimate* out) {
+  if (out != NULL) *out = g_sonar;
+}
+
+/**
+ * @brief 红外循迹：取后台采集的最新一组并发布到状态（仅控制线程调用）
+ * @note 读取失败（采集任务正在更新该槽位）时沿用上一组
+ */
+static void robot_mgr_update_ir(void) {
+  Tcrt5000SampleSet set;
+  if (!tcrt5000_get_sample_set(&set) || set.seq == g_ir.seq) return;
+  g_ir = set;
+
+  robot_mgr_update_ir_status(g_ir.state[0], g_ir.state[1], g_ir.state[2]);
+  robot_mgr_update_ir_adc(g_ir.mv[0], g_ir.mv[1], g_ir.mv[2]);
+}
+
+/**
+ * @brief 获取最新一组红外循迹采样
+ * @note 仅控制线程调用
+ */
+void robot_mgr_get_ir(Tcrt5000SampleSet* out) {
+  if (out != NULL) *out = g_ir;
+}
+
 /**
  * @brief 周期性调用函数，处理模式生命周期和状态机
  */
 void robot_mgr_tick(void) {
+  // 0. 取出本周期之前投递的全部事件
+  RobotEvent evt;
+  while (robot_event_pop(&evt)) robot_mgr_handle_event(&evt);
+
+  robot_mgr_update_sonar();
+  robot_mgr_update_ir();
+
   CarStatus current_status = g_status;  // 当前状态
   int mode_count =
       (int)(sizeof(g_mode_ops) / sizeof(g_mode_ops[0]));  // 模式数量
@@ -141,6 +351,7 @@ void robot_mgr_tick(void) {
     if (g_last_status >= CAR_STOP_STATUS && g_last_status < mode_count) {
       if (g_mode_ops[g_last_status].exit) g_mode_ops[g_last_status].exit();
     }
+    drive_ctrl_release();  // 停车并交还电机控制权，由新模式决定是否使用速度环
 
     // 进入新模式
     if (current_status >= CAR_STOP_STATUS && current_status < mode_count) {
@@ -154,31 +365,40 @@ void robot_mgr_tick(void) {
   if (current_status >= CAR_STOP_STATUS && current_status < mode_count) {
     if (g_mode_ops[current_status].tick) g_mode_ops[current_status].tick();
   }
+
+  // 3. 速度环 + 电机输出整形：斜率逐拍推进，目标未变时也要继续
+  drive_ctrl_tick();
+
+  // 4. 周期末发布一次状态快照
+  robot_mgr_publish_state();
 }
 
 /**
  * @brief 获取全局机器人状态的副本
  * @param out 输出参数，用于接收状态副本
- * @note 此函数线程安全，使用互斥锁保护数据读取
+ * @note 无锁读取：任意线程可调用，不会阻塞控制线程
  */
 void robot_mgr_get_state_copy(RobotState* out) {
   if (out == NULL) return;
 
-  // 加锁保护状态读取
-  MUTEX_LOCK(g_state_mutex, g_state_mutex_inited);
-  *out = g_robot_state;
-  MUTEX_UNLOCK(g_state_mutex, g_state_mutex_inited);
+  while (1) {
+    const RobotStateSlot* slot = &g_state_slots[g_state_pub];
+    uint32_t seq = slot->seq;
+    ROBOT_MEMORY_BARRIER();
+    if (seq & 1u) continue;  // 写者恰好在复用该槽位
+    *out = slot->state;
+    ROBOT_MEMORY_BARRIER();
+    if (slot->seq == seq) return;
+  }
 }
 
 /**
  * @brief 更新超声波测距值到全局状态
  * @param distance 距离值（单位：厘米）
- * @note 使用互斥锁保护，防止多个线程同时修改状态
+ * @note 仅控制线程调用，周期末随快照一起发布
  */
 void robot_mgr_update_distance(float distance) {
-  MUTEX_LOCK(g_state_mutex, g_state_mutex_inited);
-  g_robot_state.distance = distance;
-  MUTEX_UNLOCK(g_state_mutex, g_state_mutex_inited);
+  g_state_work.distance = distance;
 }
 
 /**
@@ -186,13 +406,41 @@ void robot_mgr_update_distance(float distance) {
  * @param left 左侧红外传感器状态
  * @param middle 中间红外传感器状态
  * @param right 右侧红外传感器状态
- * @note 使用互斥锁保护，防止多个线程同时修改状态
+ * @note 仅控制线程调用，周期末随快照一起发布
  */
 void robot_mgr_update_ir_status(unsigned int left, unsigned int middle,
                                 unsigned int right) {
-  MUTEX_LOCK(g_state_mutex, g_state_mutex_inited);
-  g_robot_state.ir_left = left;
-  g_robot_state.ir_middle = middle;
-  g_robot_state.ir_right = right;
-  MUTEX_UNLOCK(g_state_mutex, g_state_mutex_inited);
+  g_state_work.ir_left = left;
+  g_state_work.ir_middle = middle;
+  g_state_work.ir_right = right;
+}
+
+/**
+ * @brief 更新红外传感器原始 ADC 电压到全局状态
+ * @note 仅控制线程调用，周期末随快照一起发布
+ */
+void robot_mgr_update_ir_adc(uint32_t left_mv, uint32_t middle_mv,
+                             uint32_t right_mv) {
+  g_state_work.adc_left = (uint16_t)left_mv;
+  g_state_work.adc_middle = (uint16_t)middle_mv;
+  g_state_work.adc_right = (uint16_t)right_mv;
+}
+
+/**
+ * @brief 更新循迹 PID 误差与输出到全局状态
+ * @note 仅控制线程调用，周期末随快照一起发布
+ */
+void robot_mgr_update_pid(float error, float output) {
+  g_state_work.pid_error = error;
+  g_state_work.pid_output = output;
+}
+
+/**
+ * @brief 更新循迹 PID 各项分量到全局状态（供飞行记录仪使用）
+ * @note 仅控制线程调用，周期末随快照一起发布
+ */
+void robot_mgr_update_pid_terms(float p, float i, float d) {
+  g_state_work.pid_p = p;
+  g_state_work.pid_i = i;
+  g_state_work.pid_d = d;
 }
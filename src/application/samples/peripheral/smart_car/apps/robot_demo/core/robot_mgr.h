@@ -2,8 +2,11 @@
 #define ROBOT_MGR_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
+#include "../../../drivers/tcrt5000/bsp_tcrt5000.h"
 #include "../robot_common.h"
+#include "sonar_filter.h"
 
 // 模式接口定义
 typedef struct {
@@ -14,6 +17,7 @@ typedef struct {
 
 void robot_mgr_init(void);
 CarStatus robot_mgr_get_status(void);
+// 请求模式切换：非阻塞，任意线程 / 中断可调用，下个控制周期生效
 void robot_mgr_set_status(CarStatus status);
 
 /**
@@ -21,12 +25,22 @@ void robot_mgr_set_status(CarStatus status);
  */
 void robot_mgr_tick(void);
 
-// 状态查询接口
+// 状态查询接口（无锁，任意线程可调用）
 void robot_mgr_get_state_copy(RobotState* out);
 
-// 状态更新接口（线程安全）
+// 滤波后的超声波估计（仅控制线程调用，每个 tick 开始时更新）
+void robot_mgr_get_sonar(SonarEstimate* out);
+
+// 最新一组红外循迹采样（仅控制线程调用，每个 tick 开始时更新）
+void robot_mgr_get_ir(Tcrt5000SampleSet* out);
+
+// 状态更新接口（仅控制线程调用，每个 tick 末尾统一发布）
 void robot_mgr_update_distance(float distance);
 void robot_mgr_update_ir_status(unsigned int left, unsigned int middle,
                                 unsigned int right);
+void robot_mgr_update_ir_adc(uint32_t left_mv, uint32_t middle_mv,
+                             uint32_t right_mv);
+void robot_mgr_update_pid(float error, float output);
+void robot_mgr_update_pid_terms(float p, float i, float d);
 
 #endif
@@ -0,0 +1,198 @@
+/**
+ ****************************************************************************************************
+ * @file        sonar_filter.c
+ * @brief       超声波测距滤波管线实现
+ ****************************************************************************************************
+ */
+
+#include "sonar_filter.h"
+
+#include <stddef.h>
+
+#include "securec.h"
+
+#define SONAR_US_PER_S 1000000.0f
+#define SONAR_MIN_DT_S 0.001f
+#define SONAR_KF_INIT_V_VAR 10000.0f  // 卡尔曼初始速度方差 ((cm/s)^2)
+#define SONAR_SPEED_LPF 0.3f          // 未启用卡尔曼时差分速度的低通系数
+
+static inline float sonar_absf(float v) { return v < 0.0f ? -v : v; }
+
+/**
+ * @brief 求窗口中值（偶数个样本取中间两个的平均）
+ */
+static float sonar_median(const SonarFilter* f) {
+  float tmp[SONAR_FILTER_MAX_WINDOW];
+  uint8_t n = f->count;
+
+  for (uint8_t i = 0; i < n; i++) {  // 插入排序，n 很小
+    float v = f->window[i];
+    int j = (int)i - 1;
+    while (j >= 0 && tmp[j] > v) {
+      tmp[j + 1] = tmp[j];
+      j--;
+    }
+    tmp[j + 1] = v;
+  }
+  return (n & 1u) ? tmp[n / 2] : 0.5f * (tmp[n / 2 - 1] + tmp[n / 2]);
+}
+
+static void sonar_push(SonarFilter* f, float d) {
+  f->window[f->head] = d;
+  f->head = (uint8_t)((f->head + 1) % f->cfg.window);
+  if (f->count < f->cfg.window) f->count++;
+}
+
+/**
+ * @brief 匀速模型卡尔曼滤波：状态 [距离, 距离变化率]，观测为中值距离
+ */
+static void sonar_kf_step(SonarFilter* f, float z, float dt) {
+  float q = f->cfg.kf_accel_var;
+  float r = f->cfg.kf_meas_var;
+  float (*p)[2] = f->kf_p;
+
+  if (!f->kf_ready) {
+    f->kf_d = z;
+    f->kf_v = 0.0f;
+    p[0][0] = r;
+    p[0][1] = p[1][0] = 0.0f;
+    p[1][1] = SONAR_KF_INIT_V_VAR;
+    f->kf_ready = true;
+    return;
+  }
+
+  // 预测：x = F x，P = F P F' + Q
+  float dt2 = dt * dt;
+  f->kf_d += f->kf_v * dt;
+  p[0][0] += dt * (p[0][1] + p[1][0]) + dt2 * p[1][1] + q * dt2 * dt2 * 0.25f;
+  p[0][1] += dt * p[1][1] + q * dt2 * dt * 0.5f;
+  p[1][0] = p[0][1];
+  p[1][1] += q * dt2;
+
+  // 更新：观测矩阵 H = [1 0]
+  float s = p[0][0] + r;
+  float k0 = p[0][0] / s;
+  float k1 = p[1][0] / s;
+  float y = z - f->kf_d;
+  f->kf_d += k0 * y;
+  f->kf_v += k1 * y;
+
+  float p00 = p[0][0], p01 = p[0][1];
+  p[0][0] = (1.0f - k0) * p00;
+  p[0][1] = (1.0f - k0) * p01;
+  p[1][0] = p[0][1];
+  p[1][1] -= k1 * p01;
+}
+
+void sonar_filter_default_config(SonarFilterConfig* cfg) {
+  if (cfg == NULL) return;
+  cfg->window = 3;
+  cfg->outlier_abs_cm = 20.0f;
+  cfg->outlier_ratio = 0.3f;
+  cfg->outlier_limit = 2;
+  cfg->invalid_limit = 3;
+  cfg->reset_gap_ms = 500;
+  cfg->use_kalman = true;
+  cfg->kf_accel_var = 10000.0f;  // 加速度标准差约 100 cm/s^2
+  cfg->kf_meas_var = 4.0f;       // 测量标准差约 2 cm
+}
+
+void sonar_filter_init(SonarFilter* f, const SonarFilterConfig* cfg) {
+  if (f == NULL || cfg == NULL) return;
+
+  (void)memset_s(f, sizeof(*f), 0, sizeof(*f));
+  f->cfg = *cfg;
+  if (f->cfg.window == 0) f->cfg.window = 1;
+  if (f->cfg.window > SONAR_FILTER_MAX_WINDOW)
+    f->cfg.window = SONAR_FILTER_MAX_WINDOW;
+  if (f->cfg.invalid_limit == 0) f->cfg.invalid_limit = 1;
+}
+
+void sonar_filter_reset(SonarFilter* f) {
+  if (f == NULL) return;
+  f->count = 0;
+  f->head = 0;
+  f->outliers = 0;
+  f->invalids = 0;
+  f->kf_ready = false;
+  f->est.closing_speed_cm_s = 0.0f;
+}
+
+void sonar_filter_update(SonarFilter* f, float distance_cm, SonarInput input,
+                         uint64_t timestamp_us, SonarEstimate* out) {
+  if (f == NULL) return;
+
+  SonarEstimate* est = &f->est;
+  est->seq++;
+  est->timestamp_us = timestamp_us;
+
+  if (input == SONAR_INPUT_NEAR) {
+    // 紧贴障碍物：立即按 0cm 受阻输出，历史窗口不再有参考价值
+    sonar_filter_reset(f);
+    est->distance_cm = 0.0f;
+    est->valid = true;
+    est->too_close = true;
+    if (out != NULL) *out = *est;
+    return;
+  }
+  if (input != SONAR_INPUT_ECHO) {
+    // 单次超时不改变输出，连续无回波才判定未知，距离保持最后一次估计
+    if (f->invalids < UINT8_MAX) f->invalids++;
+    if (f->invalids >= f->cfg.invalid_limit) {
+      est->valid = false;
+      est->closing_speed_cm_s = 0.0f;
+    }
+    if (out != NULL) *out = *est;
+    return;
+  }
+  f->invalids = 0;
+
+  // 长时间没有有效回波：历史已无参考价值
+  if (f->count > 0 && timestamp_us - f->last_valid_us >
+                          (uint64_t)f->cfg.reset_gap_ms * 1000ULL)
+    sonar_filter_reset(f);
+  f->last_valid_us = timestamp_us;
+
+  // 离群点剔除：单次跳变丢弃，连续跳变说明距离真的变了
+  if (f->count >= 3) {
+    float med = sonar_median(f);
+    float dev = sonar_absf(distance_cm - med);
+    if (dev > f->cfg.outlier_abs_cm && dev > med * f->cfg.outlier_ratio) {
+      if (++f->outliers < f->cfg.outlier_limit) {
+        if (out != NULL) *out = *est;
+        return;
+      }
+      f->count = 0;
+      f->head = 0;
+      f->kf_ready = false;
+    }
+  }
+  f->outliers = 0;
+
+  sonar_push(f, distance_cm);
+  float med = sonar_median(f);
+
+  float dt = (float)(timestamp_us - f->update_us) / SONAR_US_PER_S;
+  if (dt < SONAR_MIN_DT_S) dt = SONAR_MIN_DT_S;
+  f->update_us = timestamp_us;
+
+  if (f->cfg.use_kalman) {
+    sonar_kf_step(f, med, dt);
+    est->distance_cm = f->kf_d;
+    est->closing_speed_cm_s = f->kf_ready ? -f->kf_v : 0.0f;
+  } else {
+    if (est->valid && f->count > 1) {
+      float speed = (est->distance_cm - med) / dt;
+      est->closing_speed_cm_s +=
+          SONAR_SPEED_LPF * (speed - est->closing_speed_cm_s);
+    } else {
+      est->closing_speed_cm_s = 0.0f;
+    }
+    est->distance_cm = med;
+  }
+  if (est->distance_cm < 0.0f) est->distance_cm = 0.0f;
+  est->valid = true;
+  est->too_close = false;
+
+  if (out != NULL) *out = *est;
+}
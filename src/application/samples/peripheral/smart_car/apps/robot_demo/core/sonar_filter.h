@@ -0,0 +1,101 @@
+/**
+ ****************************************************************************************************
+ * @file        sonar_filter.h
+ * @brief       超声波测距滤波管线
+ * @details     驱动原始结果 -> 超时 / 量程外剔除 -> 离群点剔除 -> 中值窗口
+ *              -> 可选的匀速模型卡尔曼滤波（同时估计接近速度）。
+ *              回波短于量程下限时立即按 0cm 受阻输出；超时连续若干次后
+ *              才输出无效标志并保持最后一次估计，不会被当作前方开阔。
+ *              纯计算模块，不访问硬件。
+ ****************************************************************************************************
+ */
+
+#ifndef SONAR_FILTER_H
+#define SONAR_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SONAR_FILTER_MAX_WINDOW 7  // 中值窗口最大长度
+
+/**
+ * @brief 驱动结果分类
+ */
+typedef enum {
+  SONAR_INPUT_ECHO = 0,  // 量程内的有效回波
+  SONAR_INPUT_NEAR,      // 回波短于量程下限：紧贴障碍物
+  SONAR_INPUT_NONE       // 超时无回波或远于量程上限：距离未知
+} SonarInput;
+
+/**
+ * @brief 滤波配置
+ */
+typedef struct {
+  uint8_t window;         // 中值窗口长度 (1 ~ SONAR_FILTER_MAX_WINDOW)
+  float outlier_abs_cm;   // 偏离中值超过该值（且超过比例阈值）视为离群
+  float outlier_ratio;    // 偏离中值的比例阈值
+  uint8_t outlier_limit;  // 连续离群次数达到该值时认为距离真的跳变，重建窗口
+  uint8_t invalid_limit;  // 连续无回波次数达到该值时输出无效
+  uint32_t reset_gap_ms;  // 两次有效结果间隔超过该值时重置历史
+  bool use_kalman;        // 是否启用匀速卡尔曼滤波
+  float kf_accel_var;     // 过程噪声：加速度方差 ((cm/s^2)^2)
+  float kf_meas_var;      // 测量噪声方差 (cm^2)
+} SonarFilterConfig;
+
+/**
+ * @brief 滤波输出
+ */
+typedef struct {
+  float distance_cm;         // 滤波后距离 (cm)，无效时为最后一次估计
+  float closing_speed_cm_s;  // 接近速度 (cm/s)，正值表示正在靠近障碍物
+  uint64_t timestamp_us;     // 最近一次输入结果的时刻
+  uint32_t seq;              // 输出序号，每次 update 加 1
+  bool valid;                // false 表示持续无回波，距离未知（不是开阔）
+  bool too_close;            // 回波短于量程下限，distance_cm 为 0（受阻）
+} SonarEstimate;
+
+/**
+ * @brief 滤波器状态
+ */
+typedef struct {
+  SonarFilterConfig cfg;
+  float window[SONAR_FILTER_MAX_WINDOW];  // 已接受样本（环形）
+  uint8_t count;                          // 窗口内样本数
+  uint8_t head;                           // 下一个写入位置
+  uint8_t outliers;                       // 连续离群次数
+  uint8_t invalids;                       // 连续无效次数
+  uint64_t last_valid_us;                 // 上次有效样本时刻
+  uint64_t update_us;                     // 上次更新估计的时刻
+  bool kf_ready;                          // 卡尔曼状态是否已初始化
+  float kf_d, kf_v;                       // 状态：距离、距离变化率
+  float kf_p[2][2];                       // 协方差
+  SonarEstimate est;                      // 最近一次输出
+} SonarFilter;
+
+/**
+ * @brief 填充默认配置
+ */
+void sonar_filter_default_config(SonarFilterConfig* cfg);
+
+/**
+ * @brief 按配置初始化并清空历史
+ */
+void sonar_filter_init(SonarFilter* f, const SonarFilterConfig* cfg);
+
+/**
+ * @brief 清空窗口和卡尔曼状态（保留配置）
+ */
+void sonar_filter_reset(SonarFilter* f);
+
+/**
+ * @brief 输入一次驱动结果并更新估计
+ * @param f 滤波器
+ * @param distance_cm 原始距离 (cm)，仅 SONAR_INPUT_ECHO 时有意义
+ * @param input 驱动结果分类
+ * @param timestamp_us 结果产生时刻
+ * @param out 输出估计（可为 NULL）
+ */
+void sonar_filter_update(SonarFilter* f, float distance_cm, SonarInput input,
+                         uint64_t timestamp_us, SonarEstimate* out);
+
+#endif /* SONAR_FILTER_H */
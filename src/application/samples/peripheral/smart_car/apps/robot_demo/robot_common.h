@@ -11,7 +11,10 @@ typedef enum {
   CAR_TRACE_STATUS,              /* 循迹模式：根据红外传感器进行黑线跟踪 */
   CAR_OBSTACLE_AVOIDANCE_STATUS, /* 避障模式：根据超声波传感器自动避障 */
   CAR_WIFI_CONTROL_STATUS,       /* WiFi遥控模式：通过UDP/WiFi接收控制命令 */
-  CAR_BT_CONTROL_STATUS /* 蓝牙遥控模式（未实现）：通过BLE蓝牙接收控制命令 */
+  CAR_BT_CONTROL_STATUS, /* 蓝牙遥控模式（未实现）：通过BLE蓝牙接收控制命令 */
+  CAR_CALIBRATE_STATUS,  /* 红外标定模式：原地慢转采样，计算阈值并保存 */
+  CAR_AUTOTUNE_STATUS,   /* PID 自整定模式：继电反馈实验 + 候选试跑 */
+  CAR_SCAN_AVOID_STATUS  /* 扫描避障模式：舵机扫描超声波，按直方图连续选向 */
 } CarStatus;
 
 /**
@@ -31,13 +34,27 @@ typedef enum {
 /**
  * @brief 机器人实时状态结构体
  * 用于向 Web 前端提供实时状态数据
+ * @note 由控制线程每个周期整体发布一次，读者通过 robot_mgr_get_state_copy
+ *       获取一致快照（见 robot_mgr.c 中的双缓冲序列锁）
  */
 typedef struct {
+  uint64_t timestamp_us;   // 快照发布时刻（单调递增，TCXO 微秒）
+  uint32_t seq;            // 快照序号（每次发布 +1）
   CarStatus mode;          // 当前模式 (0:Standby, 1:Trace, 2:Avoid, 3:Remote)
   float distance;          // 当前超声波距离 (cm)
   unsigned int ir_left;    // 左红外状态 (0:黑线, 1:白色)
   unsigned int ir_middle;  // 中红外状态 (0:黑线, 1:白色)
   unsigned int ir_right;   // 右红外状态 (0:黑线, 1:白色)
+  uint16_t adc_left;       // 左红外原始 ADC 电压 (mV)
+  uint16_t adc_middle;     // 中红外原始 ADC 电压 (mV)
+  uint16_t adc_right;      // 右红外原始 ADC 电压 (mV)
+  int8_t duty_left;        // 左轮指令占空比 (-100 ~ 100)
+  int8_t duty_right;       // 右轮指令占空比 (-100 ~ 100)
+  float pid_error;         // 循迹 PID 误差
+  float pid_output;        // 循迹 PID 输出
+  float pid_p;             // PID 比例项
+  float pid_i;             // PID 积分项
+  float pid_d;             // PID 微分项
 } RobotState;
 
 #endif
@@ -9,47 +9,33 @@
  ****************************************************************************************************
  */
 
+#include "../../drivers/l9110s/bsp_l9110s.h"
 #include "app_init.h"
 #include "common_def.h"
+#include "core/control_sched.h"
+#include "core/mode_obstacle.h"
 #include "core/robot_config.h"
+#include "core/robot_event.h"
 #include "core/robot_mgr.h"
 #include "gpio.h"
 #include "hal_gpio.h"
 #include "osal_timer.h"
 #include "pinctrl.h"
+#include "services/proto_router.h"
+#include "services/udp_service.h"
 #include "services/voice_service.h"
 #include "soc_osal.h"
 #include "watchdog.h"
 
 #define ROBOT_MODE_SWITCH_GPIO 3  // 按键 设置为GPIO 3
 
-// 上次按键触发的时间戳（用于按键防抖，避免抖动时多次触发）
-static unsigned long long button_time_tick = 0;
-
 /**
- * @brief 按键中断：停止 -> 循迹 -> 避障 -> WiFi -> 停止
+ * @brief 按键中断：只投递按键事件，防抖和模式循环由控制线程处理
  */
 static void mode_switch_isr(pin_t pin, uintptr_t param) {
   UNUSED(pin);
   UNUSED(param);
-
-  unsigned long long current_tick = osal_get_jiffies();
-  if ((current_tick - button_time_tick) < osal_msecs_to_jiffies(200)) {
-    return;  // 防抖
-  }
-  button_time_tick = current_tick;
-
-  CarStatus current_status = robot_mgr_get_status();
-
-  // 模式循环切换：停止 -> 循迹 -> 避障 -> 遥控 -> 停止
-  CarStatus next_status = (CarStatus)((current_status + 1) % 4);
-
-  // 打印切换信息
-  const char* mode_names[] = {"停止", "循迹", "避障", "遥控"};
-  printf("模式切换：%s -> %s\r\n", mode_names[current_status],
-         mode_names[next_status]);
-
-  robot_mgr_set_status(next_status);
+  (void)robot_event_post_button();
 }
 
 /**
@@ -66,6 +52,56 @@ static void robot_key_init(void) {
                               GPIO_INTERRUPT_FALLING_EDGE, mode_switch_isr);
 }
 
+/**
+ * @brief 服务组：喂狗
+ */
+static void robot_service_tick(void) {
+  uapi_watchdog_kick();  // 喂狗
+}
+
+/**
+ * @brief 打印避障 tick 最坏耗时，并与控制周期比较
+ */
+static void robot_dump_tick_cost(uint32_t worst_us) {
+  uint32_t budget_us = 1000000u / CONTROL_LOOP_HZ;
+  printf("[诊断] 避障 tick 最坏耗时 %uus / 周期 %uus%s\r\n",
+         (unsigned)worst_us, (unsigned)budget_us,
+         worst_us > budget_us ? "（超出周期）" : "");
+}
+
+/**
+ * @brief 诊断组：出现新的超限时打印调度统计、电机更新和避障 tick 耗时，
+ *        避障 tick 最坏耗时变大时单独打印，
+ *        每 NET_DIAG_PERIOD_S 秒打印一次网络事件循环和协议统计
+ */
+static void robot_diag_tick(void) {
+  static uint32_t last_overruns = 0;
+  static uint32_t last_tick_max_us = 0;
+  static uint32_t net_ticks = 0;
+  uint32_t overruns = 0;
+  ControlSchedStats st;
+
+  for (int i = 0; control_sched_get_stats(i, &st); i++)
+    overruns += st.overruns;
+
+  uint32_t tick_max_us = mode_obstacle_get_max_tick_us();
+  if (overruns != last_overruns) {
+    last_overruns = overruns;
+    control_sched_dump_stats();
+    l9110s_dump_stats();
+    robot_dump_tick_cost(tick_max_us);
+  } else if (tick_max_us > last_tick_max_us) {
+    robot_dump_tick_cost(tick_max_us);
+  }
+  last_tick_max_us = tick_max_us;  // 进入避障模式时清零，之后重新比较
+
+  if (++net_ticks >= NET_DIAG_PERIOD_S * DIAG_LOOP_HZ) {
+    net_ticks = 0;
+    udp_service_dump_stats();
+    proto_router_dump_stats();
+  }
+}
+
 /**
  * @brief 智能小车主任务
  */
@@ -76,11 +112,19 @@ static void* robot_demo_task(const char* arg) {
   voice_service_init();  // 初始化UART命令服务
   robot_key_init();      // 初始化按键控制
 
+  if (control_sched_init(CONTROL_BASE_HZ) == 0) {
+    control_sched_add_group("control", CONTROL_LOOP_HZ, robot_mgr_tick);
+    control_sched_add_group("service", SERVICE_LOOP_HZ, robot_service_tick);
+    control_sched_add_group("diag", DIAG_LOOP_HZ, robot_diag_tick);
+    control_sched_run();  // 由硬件定时器按固定周期驱动，不返回
+  }
+
+  // 定时器不可用时退回软件延时循环
+  printf("控制调度器不可用，使用软件延时循环\r\n");
   while (1) {
     robot_mgr_tick();      // 执行小车逻辑
-    voice_service_tick();  // 执行UART命令服务
-    uapi_watchdog_kick();  // 喂狗
-    osal_msleep(20);       // 调度让权延时
+    robot_service_tick();  // 喂狗
+    osal_msleep(LOOP_DELAY);  // 调度让权延时
   }
 
   return NULL;
@@ -0,0 +1,152 @@
+/**
+ * @file        flight_recorder.c
+ * @brief       控制环飞行记录仪实现
+ * @details     环形缓冲区使用自由递增的读/写索引：写索引只由控制线程修改，
+ *              读索引只由导出线程修改，双方都不加锁。缓冲区满时丢弃新记录
+ *              并计数，控制线程永不等待。芯片不支持原子读改写，每个共享
+ *              变量都只有一个写者：丢弃计数只增不减，复位请求用序号传递
+ */
+
+#include "flight_recorder.h"
+
+#include <stdio.h>
+
+#include "../core/robot_config.h"
+#include "soc_osal.h"
+#include "udp_service.h"
+
+#if (FLIGHT_REC_CAPACITY & (FLIGHT_REC_CAPACITY - 1)) != 0
+#error "FLIGHT_REC_CAPACITY must be a power of two"
+#endif
+
+#define FLIGHT_REC_MASK (FLIGHT_REC_CAPACITY - 1)
+
+static FlightRecord g_ring[FLIGHT_REC_CAPACITY];
+static volatile uint32_t g_head = 0;     /* 写索引（控制线程） */
+static volatile uint32_t g_tail = 0;     /* 读索引（导出线程） */
+static volatile uint32_t g_dropped = 0;  /* 累计丢弃计数（控制线程） */
+static volatile bool g_enabled = false;
+static volatile uint32_t g_reset_seq = 0;  /* 复位请求序号（UDP 任务） */
+static uint16_t g_seq = 0;
+
+/**
+ * @brief 浮点定标为 int16 并饱和
+ */
+static int16_t flight_scale(float v, float k) {
+  float x = v * k;
+  if (x > 32767.0f) return 32767;
+  if (x < -32768.0f) return -32768;
+  return (int16_t)x;
+}
+
+/**
+ * @brief 距离 (cm) 转为 mm 并饱和到 uint16
+ */
+static uint16_t flight_dist_mm(float cm) {
+  if (cm <= 0.0f) return 0;
+  if (cm >= 6553.0f) return 65535;
+  return (uint16_t)(cm * 10.0f);
+}
+
+void flight_recorder_log(const RobotState* state) {
+  if (!g_enabled || state == NULL) return;
+
+  uint32_t head = g_head;
+  if (head - g_tail >= FLIGHT_REC_CAPACITY) {
+    g_dropped++;
+    g_seq++;  // 丢弃的记录也占用序号，上位机可据此定位缺口
+    return;
+  }
+
+  FlightRecord* r = &g_ring[head & FLIGHT_REC_MASK];
+  r->t_us = (uint32_t)state->timestamp_us;
+  r->seq = g_seq++;
+  r->adc[0] = state->adc_left;
+  r->adc[1] = state->adc_middle;
+  r->adc[2] = state->adc_right;
+  r->error_milli = flight_scale(state->pid_error, 1000.0f);
+  r->p_centi = flight_scale(state->pid_p, 100.0f);
+  r->i_centi = flight_scale(state->pid_i, 100.0f);
+  r->d_centi = flight_scale(state->pid_d, 100.0f);
+  r->duty_left = state->duty_left;
+  r->duty_right = state->duty_right;
+  r->dist_mm = flight_dist_mm(state->distance);
+  r->mode = (uint8_t)state->mode;
+  r->reserved = 0;
+
+  ROBOT_MEMORY_BARRIER();  // 记录内容先于索引可见
+  g_head = head + 1;
+}
+
+uint32_t flight_recorder_drain(FlightRecord* out, uint32_t max) {
+  if (out == NULL) return 0;
+
+  uint32_t tail = g_tail;
+  uint32_t avail = g_head - tail;
+  ROBOT_MEMORY_BARRIER();  // 先读索引再读记录
+  if (avail > max) avail = max;
+
+  for (uint32_t i = 0; i < avail; i++)
+    out[i] = g_ring[(tail + i) & FLIGHT_REC_MASK];
+
+  ROBOT_MEMORY_BARRIER();  // 读完记录再释放槽位
+  g_tail = tail + avail;
+  return avail;
+}
+
+void flight_recorder_set_enabled(bool enabled) {
+  if (enabled && !g_enabled) {
+    g_reset_seq++;  // 由导出线程执行复位
+    ROBOT_MEMORY_BARRIER();
+  }
+  g_enabled = enabled;
+  printf("[记录仪] %s\r\n", enabled ? "开始记录" : "停止记录");
+}
+
+bool flight_recorder_is_enabled(void) { return g_enabled; }
+
+/**
+ * @brief 导出任务：周期性批量取出记录并发送
+ */
+static void* flight_export_task(const char* arg) {
+  (void)arg;
+  static uint8_t pkt[sizeof(FlightPacketHeader) +
+                     FLIGHT_EXPORT_BATCH * sizeof(FlightRecord)];
+  FlightPacketHeader* hdr = (FlightPacketHeader*)pkt;
+  FlightRecord* recs = (FlightRecord*)(pkt + sizeof(FlightPacketHeader));
+  uint32_t reset_seen = 0;    // 已处理的复位请求序号
+  uint32_t dropped_base = 0;  // 复位时的丢弃计数，上报本次记录以来的增量
+
+  while (1) {
+    osal_msleep(FLIGHT_EXPORT_PERIOD_MS);
+
+    uint32_t reset_seq = g_reset_seq;
+    if (reset_seq != reset_seen) {
+      // 读索引归导出线程所有，复位在此完成；丢弃计数只记基准，不写回
+      reset_seen = reset_seq;
+      ROBOT_MEMORY_BARRIER();
+      dropped_base = g_dropped;
+      g_tail = g_head;
+    }
+    if (!g_enabled) continue;
+
+    for (int b = 0; b < FLIGHT_EXPORT_MAX_BATCHES; b++) {
+      uint32_t n = flight_recorder_drain(recs, FLIGHT_EXPORT_BATCH);
+      if (n == 0) break;
+      hdr->type = FLIGHT_PKT_TYPE;
+      hdr->version = FLIGHT_PKT_VERSION;
+      hdr->count = (uint16_t)n;
+      hdr->dropped = g_dropped - dropped_base;
+      (void)udp_service_send_to_peer(
+          pkt, sizeof(FlightPacketHeader) + n * sizeof(FlightRecord));
+    }
+  }
+  return NULL;
+}
+
+void flight_recorder_init(void) {
+  osal_task* task =
+      osal_kthread_create((osal_kthread_handler)flight_export_task, NULL,
+                          "flight_export", FLIGHT_EXPORT_STACK_SIZE);
+  if (task) osal_kthread_set_priority(task, FLIGHT_EXPORT_PRIORITY);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file        flight_recorder.h
+ * @brief       控制环飞行记录仪
+ * @details     控制线程每个 tick 写入一条紧凑二进制记录到固定大小的无锁环形
+ *              缓冲区（单生产者/单消费者），低优先级导出任务批量取出并通过
+ *              UDP 发给当前连接的上位机，上位机用 tools/flight_decode.py 转 CSV
+ */
+
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../robot_common.h"
+
+#define FLIGHT_REC_CAPACITY 512        // 环形缓冲区记录数（必须为 2 的幂）
+#define FLIGHT_EXPORT_BATCH 40         // 每个 UDP 包最多携带的记录数
+#define FLIGHT_EXPORT_PERIOD_MS 20     // 导出任务唤醒周期
+#define FLIGHT_EXPORT_MAX_BATCHES 4    // 每次唤醒最多发送的包数
+#define FLIGHT_EXPORT_STACK_SIZE 2048  // 导出任务栈大小
+#define FLIGHT_EXPORT_PRIORITY 28      // 导出任务优先级（低于控制和 UDP 任务）
+
+#define FLIGHT_PKT_TYPE 0x20  // UDP 包类型：飞行记录
+#define FLIGHT_PKT_VERSION 1  // 记录格式版本
+
+#pragma pack(1)
+/**
+ * @brief 单条飞行记录（26 字节，小端）
+ */
+typedef struct {
+  uint32_t t_us;        // tick 时刻（TCXO 微秒低 32 位）
+  uint16_t seq;         // 记录序号（用于检测丢失）
+  uint16_t adc[3];      // 左/中/右红外电压 (mV)
+  int16_t error_milli;  // 循迹误差 × 1000
+  int16_t p_centi;      // PID 比例项 × 100
+  int16_t i_centi;      // PID 积分项 × 100
+  int16_t d_centi;      // PID 微分项 × 100
+  int8_t duty_left;     // 左轮占空比
+  int8_t duty_right;    // 右轮占空比
+  uint16_t dist_mm;     // 超声波距离 (mm)
+  uint8_t mode;         // 当前模式
+  uint8_t reserved;
+} FlightRecord;
+
+/**
+ * @brief 导出包头（后跟 count 条 FlightRecord）
+ */
+typedef struct {
+  uint8_t type;      // FLIGHT_PKT_TYPE
+  uint8_t version;   // FLIGHT_PKT_VERSION
+  uint16_t count;    // 本包记录数
+  uint32_t dropped;  // 累计因缓冲区满丢弃的记录数
+} FlightPacketHeader;
+#pragma pack()
+
+/**
+ * @brief 创建导出任务（默认不记录）
+ */
+void flight_recorder_init(void);
+
+/**
+ * @brief 开始/停止记录与导出
+ * @note 开始时丢弃缓冲区中的旧记录并清零丢弃计数
+ */
+void flight_recorder_set_enabled(bool enabled);
+bool flight_recorder_is_enabled(void);
+
+/**
+ * @brief 写入一条记录（仅控制线程调用，不阻塞）
+ * @param state 本 tick 的状态
+ */
+void flight_recorder_log(const RobotState* state);
+
+/**
+ * @brief 取出最多 max 条记录（仅导出线程调用）
+ * @return 实际取出条数
+ */
+uint32_t flight_recorder_drain(FlightRecord* out, uint32_t max);
+
+#endif
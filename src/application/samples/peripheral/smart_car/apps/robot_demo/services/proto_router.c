@@ -0,0 +1,142 @@
+/**
+ * @file        proto_router.c
+ * @brief       上位机命令路由实现
+ */
+
+#include "proto_router.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../core/cmd_bus.h"
+#include "../robot_common.h"
+#include "flight_recorder.h"
+#include "tcxo.h"
+#include "telemetry_stream.h"
+
+static ProtoRouterStats g_stats[ROBOT_SRC_NUM];
+static uint16_t g_last_seq[ROBOT_SRC_NUM];
+static bool g_seq_valid[ROBOT_SRC_NUM];
+
+static RobotEventSource route_source(void* ctx) {
+  return *(const RobotEventSource*)ctx;
+}
+
+static void on_drive(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                     void* ctx) {
+  (void)frame;
+  // value[0] 为 8 位帧序号，0 表示不带序号（语义同旧版控制包）
+  (void)cmd_bus_publish(route_source(ctx), tlv->value[0],
+                        (int8_t)tlv->value[1], (int8_t)tlv->value[2],
+                        CMD_BUS_DEFAULT_TTL_MS);
+}
+
+static void on_mode(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                    void* ctx) {
+  (void)frame;
+  if (tlv->value[0] <= CAR_SCAN_AVOID_STATUS)
+    (void)robot_event_post_mode(route_source(ctx), tlv->value[0]);
+}
+
+static void on_pid(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                   void* ctx) {
+  (void)frame;
+  // 由控制线程修改参数并写 NV
+  (void)robot_event_post_pid(route_source(ctx), tlv->value[0],
+                             (int16_t)robot_proto_get_be16(&tlv->value[1]));
+}
+
+static void on_flight(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                      void* ctx) {
+  (void)frame;
+  if (route_source(ctx) == ROBOT_SRC_UDP)
+    flight_recorder_set_enabled(tlv->value[0] != 0);
+}
+
+static void on_stream(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                      void* ctx) {
+  (void)frame;
+  // 状态流仅在 UDP 上提供，由 UDP 任务按新周期调整定时器
+  if (route_source(ctx) == ROBOT_SRC_UDP)
+    telemetry_stream_set_rate(tlv->value[0], uapi_tcxo_get_ms());
+}
+
+static void on_ack(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                   void* ctx) {
+  (void)frame;
+  if (route_source(ctx) == ROBOT_SRC_UDP)
+    telemetry_stream_on_ack(robot_proto_get_be16(tlv->value),
+                            uapi_tcxo_get_ms());
+}
+
+static void on_heartbeat(const RobotProtoFrame* frame, const RobotTlv* tlv,
+                         void* ctx) {
+  // 保活由传输层在收到任意有效帧时刷新，这里无需处理
+  (void)frame;
+  (void)tlv;
+  (void)ctx;
+}
+
+static const RobotProtoRoute g_routes[] = {
+    {ROBOT_TLV_DRIVE, 3, on_drive},          // [seq][left][right]
+    {ROBOT_TLV_MODE, 1, on_mode},            // [mode]
+    {ROBOT_TLV_PID, 3, on_pid},              // [param][value i16]
+    {ROBOT_TLV_STREAM, 1, on_stream},        // [rate_hz]
+    {ROBOT_TLV_ACK, 2, on_ack},              // [seq u16]
+    {ROBOT_TLV_FLIGHT, 1, on_flight},        // [enable]
+    {ROBOT_TLV_HEARTBEAT, 0, on_heartbeat},  // 无 value
+};
+
+int proto_router_handle(RobotEventSource source, const uint8_t* data,
+                        size_t len, RobotProtoFrame* frame) {
+  RobotProtoFrame local;
+  if (!frame) frame = &local;
+  if (source >= ROBOT_SRC_NUM) return ROBOT_PROTO_ERR_MAGIC;
+
+  ProtoRouterStats* st = &g_stats[source];
+  int ret = robot_proto_parse(data, len, frame);
+  if (ret != ROBOT_PROTO_OK) {
+    if (ret == ROBOT_PROTO_ERR_CRC)
+      st->crc_errors++;
+    else
+      st->errors++;
+    return ret;
+  }
+
+  if (frame->legacy) {
+    st->legacy++;
+  } else {
+    st->frames++;
+    uint16_t expect = (uint16_t)(g_last_seq[source] + 1);
+    if (g_seq_valid[source] && frame->seq != expect) st->seq_gaps++;
+    g_last_seq[source] = frame->seq;
+    g_seq_valid[source] = true;
+  }
+
+  ret = robot_proto_dispatch(frame, g_routes,
+                             sizeof(g_routes) / sizeof(g_routes[0]), &source);
+  if (ret < 0) st->errors++;
+  return ret;
+}
+
+void proto_router_get_stats(RobotEventSource source, ProtoRouterStats* out) {
+  if (!out) return;
+  if (source >= ROBOT_SRC_NUM) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  *out = g_stats[source];
+}
+
+void proto_router_dump_stats(void) {
+  static const RobotEventSource sources[] = {ROBOT_SRC_UDP, ROBOT_SRC_SLE};
+  static const char* const names[] = {"UDP", "SLE"};
+  for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+    ProtoRouterStats st;
+    proto_router_get_stats(sources[i], &st);
+    printf("[协议] %s v2帧:%u 旧版帧:%u CRC错误:%u 其他错误:%u 序号跳变:%u\r\n",
+           names[i], (unsigned)st.frames, (unsigned)st.legacy,
+           (unsigned)st.crc_errors, (unsigned)st.errors,
+           (unsigned)st.seq_gaps);
+  }
+}
@@ -0,0 +1,50 @@
+/**
+ * @file        proto_router.h
+ * @brief       上位机命令路由（UDP / SLE 共用）
+ * @details     解析 v2 帧或旧版 5 字节帧，按 TLV 类型查表分发：
+ *              电机命令发布到 cmd_bus，模式 / PID 投递到 robot_event，
+ *              飞行记录仪开关仅接受 UDP（记录只经 UDP 导出）。
+ */
+
+#ifndef PROTO_ROUTER_H
+#define PROTO_ROUTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../core/robot_event.h"
+#include "robot_proto.h"
+
+/**
+ * @brief 单个来源的统计
+ */
+typedef struct {
+  uint32_t frames;      // 解析成功的 v2 帧数
+  uint32_t legacy;      // 解析成功的旧版帧数
+  uint32_t crc_errors;  // CRC 校验失败的帧数
+  uint32_t errors;      // 其他解析失败（长度 / 版本 / TLV 越界 / 未知类型）
+  uint32_t seq_gaps;    // v2 帧序号不连续的次数（UDP 丢包或乱序）
+} ProtoRouterStats;
+
+/**
+ * @brief 处理一帧上位机数据（每个来源只允许一个线程 / 回调调用）
+ * @param source 来源（ROBOT_SRC_UDP / ROBOT_SRC_SLE）
+ * @param data 原始数据
+ * @param len 数据长度
+ * @param frame 输出解析结果（可为 NULL），调用方据此判断对端协议版本
+ * @return 已处理的 TLV 个数，解析失败返回 RobotProtoError
+ */
+int proto_router_handle(RobotEventSource source, const uint8_t* data,
+                        size_t len, RobotProtoFrame* frame);
+
+/**
+ * @brief 读取某来源的统计
+ */
+void proto_router_get_stats(RobotEventSource source, ProtoRouterStats* out);
+
+/**
+ * @brief 打印 UDP / SLE 两个来源的帧统计
+ */
+void proto_router_dump_stats(void);
+
+#endif /* PROTO_ROUTER_H */
@@ -0,0 +1,184 @@
+/**
+ * @file        robot_proto.c
+ * @brief       上位机通信协议 v2 编解码实现
+ */
+
+#include "robot_proto.h"
+
+#include <string.h>
+
+// 帧头字段偏移
+#define OFF_MAGIC 0
+#define OFF_VERSION 1
+#define OFF_FLAGS 2
+#define OFF_SEQ 4
+#define OFF_BODY_LEN 6
+#define OFF_TIMESTAMP 8
+
+// CRC-16/CCITT 半字节查表（16 项，兼顾速度和 Flash 占用）
+static const uint16_t g_crc16_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+uint16_t robot_proto_crc16(const uint8_t* data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc = (uint16_t)((crc << 4) ^
+                     g_crc16_nibble[(crc >> 12) ^ (data[i] >> 4)]);
+    crc = (uint16_t)((crc << 4) ^
+                     g_crc16_nibble[(crc >> 12) ^ (data[i] & 0x0F)]);
+  }
+  return crc;
+}
+
+static void put_be32(uint8_t* p, uint32_t v) {
+  robot_proto_put_be16(p, (uint16_t)(v >> 16));
+  robot_proto_put_be16(p + 2, (uint16_t)v);
+}
+
+static uint32_t get_be32(const uint8_t* p) {
+  return ((uint32_t)robot_proto_get_be16(p) << 16) |
+         robot_proto_get_be16(p + 2);
+}
+
+void robot_proto_begin(RobotProtoWriter* w, uint8_t* buf, size_t cap,
+                       uint8_t flags, uint16_t seq, uint32_t timestamp_us) {
+  w->buf = buf;
+  w->cap = cap;
+  w->len = ROBOT_PROTO_HDR_LEN;
+  w->overflow = cap < ROBOT_PROTO_OVERHEAD;
+  if (w->overflow) return;
+
+  buf[OFF_MAGIC] = ROBOT_PROTO_MAGIC;
+  buf[OFF_VERSION] = ROBOT_PROTO_VERSION;
+  buf[OFF_FLAGS] = flags;
+  buf[OFF_FLAGS + 1] = 0;
+  robot_proto_put_be16(&buf[OFF_SEQ], seq);
+  robot_proto_put_be16(&buf[OFF_BODY_LEN], 0);
+  put_be32(&buf[OFF_TIMESTAMP], timestamp_us);
+}
+
+int robot_proto_put(RobotProtoWriter* w, uint8_t type, const void* value,
+                    uint8_t len) {
+  // 预留 CRC 空间，保证 finish 一定成功
+  size_t need = ROBOT_PROTO_TLV_HDR_LEN + len;
+  if (w->cap < ROBOT_PROTO_OVERHEAD ||
+      w->len + need + ROBOT_PROTO_CRC_LEN > w->cap) {
+    w->overflow = true;
+    return -1;
+  }
+  w->buf[w->len] = type;
+  w->buf[w->len + 1] = len;
+  if (len > 0) memcpy(&w->buf[w->len + ROBOT_PROTO_TLV_HDR_LEN], value, len);
+  w->len += need;
+  return 0;
+}
+
+int robot_proto_finish(RobotProtoWriter* w) {
+  if (w->cap < ROBOT_PROTO_OVERHEAD) return -1;
+  robot_proto_put_be16(&w->buf[OFF_BODY_LEN],
+                       (uint16_t)(w->len - ROBOT_PROTO_HDR_LEN));
+  robot_proto_put_be16(&w->buf[w->len], robot_proto_crc16(w->buf, w->len));
+  return (int)(w->len + ROBOT_PROTO_CRC_LEN);
+}
+
+/**
+ * @brief 旧版 5 字节帧转换为等价 TLV，返回 value 长度，未知类型返回 -1
+ */
+static int legacy_to_tlv(const uint8_t* data, uint8_t* value) {
+  switch (data[0]) {
+    case ROBOT_TLV_DRIVE:  // [seq][m1][m2]
+    case ROBOT_TLV_PID:    // [param][高字节][低字节]
+      memcpy(value, &data[1], 3);
+      return 3;
+    case ROBOT_TLV_STATUS:  // 旧版距离为 cm * 10 的 int8，即 mm
+      value[0] = data[1];
+      robot_proto_put_be16(&value[1], data[2]);
+      value[3] = data[4];
+      return 4;
+    case ROBOT_TLV_MODE:
+    case ROBOT_TLV_FLIGHT:
+      value[0] = data[1];
+      return 1;
+    case ROBOT_TLV_HEARTBEAT:
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+int robot_proto_parse(const uint8_t* data, size_t len, RobotProtoFrame* out) {
+  memset(out, 0, sizeof(*out));
+  if (!data || len < 1) return ROBOT_PROTO_ERR_SHORT;
+
+  if (data[OFF_MAGIC] != ROBOT_PROTO_MAGIC) {
+    if (len != ROBOT_PROTO_LEGACY_LEN) return ROBOT_PROTO_ERR_MAGIC;
+    uint8_t* tlv = out->legacy_body;
+    int n = legacy_to_tlv(data, &tlv[ROBOT_PROTO_TLV_HDR_LEN]);
+    if (n < 0) return ROBOT_PROTO_ERR_MAGIC;
+    tlv[0] = data[0];
+    tlv[1] = (uint8_t)n;
+    out->legacy = true;
+    out->body = tlv;
+    out->body_len = (uint16_t)(ROBOT_PROTO_TLV_HDR_LEN + n);
+    return ROBOT_PROTO_OK;
+  }
+
+  if (len < ROBOT_PROTO_OVERHEAD) return ROBOT_PROTO_ERR_SHORT;
+  if (data[OFF_VERSION] != ROBOT_PROTO_VERSION)
+    return ROBOT_PROTO_ERR_VERSION;
+  uint16_t body_len = robot_proto_get_be16(&data[OFF_BODY_LEN]);
+  if ((size_t)body_len + ROBOT_PROTO_OVERHEAD != len)
+    return ROBOT_PROTO_ERR_LEN;
+
+  size_t crc_off = ROBOT_PROTO_HDR_LEN + body_len;
+  if (robot_proto_crc16(data, crc_off) != robot_proto_get_be16(&data[crc_off]))
+    return ROBOT_PROTO_ERR_CRC;
+
+  out->flags = data[OFF_FLAGS];
+  out->seq = robot_proto_get_be16(&data[OFF_SEQ]);
+  out->timestamp_us = get_be32(&data[OFF_TIMESTAMP]);
+  out->body = &data[ROBOT_PROTO_HDR_LEN];
+  out->body_len = body_len;
+  return ROBOT_PROTO_OK;
+}
+
+int robot_proto_next_tlv(const RobotProtoFrame* frame, size_t* offset,
+                         RobotTlv* tlv) {
+  size_t off = *offset;
+  if (off >= frame->body_len) return 0;
+  if (off + ROBOT_PROTO_TLV_HDR_LEN > frame->body_len)
+    return ROBOT_PROTO_ERR_TLV;
+
+  uint8_t len = frame->body[off + 1];
+  if (off + ROBOT_PROTO_TLV_HDR_LEN + len > frame->body_len)
+    return ROBOT_PROTO_ERR_TLV;
+
+  tlv->type = frame->body[off];
+  tlv->len = len;
+  tlv->value = &frame->body[off + ROBOT_PROTO_TLV_HDR_LEN];
+  *offset = off + ROBOT_PROTO_TLV_HDR_LEN + len;
+  return 1;
+}
+
+int robot_proto_dispatch(const RobotProtoFrame* frame,
+                         const RobotProtoRoute* routes, size_t route_num,
+                         void* ctx) {
+  size_t offset = 0;
+  RobotTlv tlv;
+  int handled = 0;
+  int ret;
+
+  while ((ret = robot_proto_next_tlv(frame, &offset, &tlv)) > 0) {
+    for (size_t i = 0; i < route_num; i++) {
+      if (routes[i].type != tlv.type) continue;
+      if (tlv.len >= routes[i].min_len && routes[i].handler) {
+        routes[i].handler(frame, &tlv, ctx);
+        handled++;
+      }
+      break;
+    }
+  }
+  return ret < 0 ? ret : handled;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file        robot_proto.h
+ * @brief       上位机通信协议 v2 编解码（与传输层无关）
+ * @details     帧格式（多字节字段大端）:
+ *                [magic 0xB5][version 2][flags][保留 0][seq u16][body_len u16]
+ *                [timestamp_us u32][TLV...][CRC-16 u16]
+ *              TLV 为 [type u8][len u8][value]，一帧可批量携带多个 TLV；
+ *              CRC-16/CCITT-FALSE 覆盖帧头和全部 TLV。
+ *              旧版 5 字节帧 [type][cmd][m1][m2][ext] 解析时转换为等价的
+ *              单个 TLV，UDP / SLE / 代理共用同一张路由表处理。
+ *              纯计算模块，不访问硬件和网络。
+ */
+
+#ifndef ROBOT_PROTO_H
+#define ROBOT_PROTO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ROBOT_PROTO_MAGIC 0xB5     // 帧头魔数（不与任何旧版包类型冲突）
+#define ROBOT_PROTO_VERSION 2      // 协议版本
+#define ROBOT_PROTO_HDR_LEN 12     // 帧头长度
+#define ROBOT_PROTO_CRC_LEN 2      // 帧尾 CRC 长度
+#define ROBOT_PROTO_TLV_HDR_LEN 2  // TLV 头长度 (type + len)
+#define ROBOT_PROTO_OVERHEAD (ROBOT_PROTO_HDR_LEN + ROBOT_PROTO_CRC_LEN)
+#define ROBOT_PROTO_MAX_FRAME 128  // 单帧最大长度（UDP 接收缓冲区 / SLE 包长）
+#define ROBOT_PROTO_LEGACY_LEN 5   // 旧版固定帧长度
+
+#define ROBOT_PROTO_FLAG_UPLINK 0x01  // 小车 -> 上位机
+
+/**
+ * @brief TLV 类型（下行类型与旧版包类型编号一致）
+ */
+typedef enum {
+  ROBOT_TLV_DRIVE = 0x01,         // 下行 [seq u8][left i8][right i8]
+  ROBOT_TLV_STATUS = 0x02,        // 上行 [mode u8][distance_mm u16][ir_bits u8]
+  ROBOT_TLV_MODE = 0x03,          // 下行 [mode u8]
+  ROBOT_TLV_PID = 0x04,           // 下行 [param u8][value i16]
+  ROBOT_TLV_STREAM = 0x05,        // 下行 [rate_hz u8]，0 关闭状态流
+  ROBOT_TLV_ACK = 0x06,           // 下行 [seq u16] 确认已解码的状态流帧
+  ROBOT_TLV_LINE_ADC = 0x10,      // 上行 [left u16][middle u16][right u16] (mV)
+  ROBOT_TLV_MOTOR = 0x11,         // 上行 [duty_left i8][duty_right i8]
+  ROBOT_TLV_TELEM_BASE = 0x12,    // 上行 [base_seq u16] 增量基准帧
+  ROBOT_TLV_TELEM_SAMPLE = 0x13,  // 上行 [dt_ms u8][mask u16][字段...]
+  ROBOT_TLV_FLIGHT = 0x20,        // 下行 [enable u8]
+  ROBOT_TLV_HEARTBEAT = 0xFE      // 双向，无 value
+} RobotTlvType;
+
+/**
+ * @brief 解析错误码
+ */
+typedef enum {
+  ROBOT_PROTO_OK = 0,
+  ROBOT_PROTO_ERR_SHORT = -1,    // 长度不足
+  ROBOT_PROTO_ERR_MAGIC = -2,    // 既不是 v2 帧也不是旧版帧
+  ROBOT_PROTO_ERR_VERSION = -3,  // 不支持的版本
+  ROBOT_PROTO_ERR_LEN = -4,      // body_len 与实际长度不符
+  ROBOT_PROTO_ERR_CRC = -5,      // CRC 校验失败
+  ROBOT_PROTO_ERR_TLV = -6       // TLV 越界
+} RobotProtoError;
+
+/**
+ * @brief 解析结果（body 指向原始缓冲区或 legacy_body，生命周期同输入）
+ */
+typedef struct {
+  bool legacy;            // 是否为旧版 5 字节帧
+  uint8_t flags;          // ROBOT_PROTO_FLAG_*
+  uint16_t seq;           // 帧序号（旧版帧为 0）
+  uint32_t timestamp_us;  // 发送方时间戳（旧版帧为 0）
+  const uint8_t* body;    // TLV 区
+  uint16_t body_len;      // TLV 区长度
+  uint8_t legacy_body[ROBOT_PROTO_TLV_HDR_LEN + 4];  // 旧版帧转换出的 TLV
+} RobotProtoFrame;
+
+/**
+ * @brief 单个 TLV
+ */
+typedef struct {
+  uint8_t type;
+  uint8_t len;
+  const uint8_t* value;
+} RobotTlv;
+
+/**
+ * @brief 编码器（在调用方提供的缓冲区上原地组帧）
+ */
+typedef struct {
+  uint8_t* buf;
+  size_t cap;
+  size_t len;     // 已写入长度（含帧头）
+  bool overflow;  // 是否有 TLV 因空间不足被拒绝
+} RobotProtoWriter;
+
+/**
+ * @brief TLV 处理函数
+ * @param frame 所在帧
+ * @param tlv 当前 TLV（长度已按路由表的 min_len 检查）
+ * @param ctx 调用方上下文
+ */
+typedef void (*RobotProtoHandler)(const RobotProtoFrame* frame,
+                                  const RobotTlv* tlv, void* ctx);
+
+/**
+ * @brief 路由表项
+ */
+typedef struct {
+  uint8_t type;               // RobotTlvType
+  uint8_t min_len;            // value 最小长度，不足时跳过
+  RobotProtoHandler handler;  // 处理函数
+} RobotProtoRoute;
+
+/**
+ * @brief CRC-16/CCITT-FALSE（多项式 0x1021，初值 0xFFFF）
+ */
+uint16_t robot_proto_crc16(const uint8_t* data, size_t len);
+
+static inline void robot_proto_put_be16(uint8_t* p, uint16_t v) {
+  p[0] = (uint8_t)(v >> 8);
+  p[1] = (uint8_t)v;
+}
+
+static inline uint16_t robot_proto_get_be16(const uint8_t* p) {
+  return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+/**
+ * @brief 开始组帧
+ * @param w 编码器
+ * @param buf 输出缓冲区（至少 ROBOT_PROTO_OVERHEAD 字节）
+ * @param cap 缓冲区长度
+ * @param flags ROBOT_PROTO_FLAG_*
+ * @param seq 帧序号
+ * @param timestamp_us 发送时刻（微秒低 32 位）
+ */
+void robot_proto_begin(RobotProtoWriter* w, uint8_t* buf, size_t cap,
+                       uint8_t flags, uint16_t seq, uint32_t timestamp_us);
+
+/**
+ * @brief 追加一个 TLV
+ * @return 0 成功，-1 空间不足（帧内容不变，置 overflow）
+ */
+int robot_proto_put(RobotProtoWriter* w, uint8_t type, const void* value,
+                    uint8_t len);
+
+/**
+ * @brief 填写 body_len 并追加 CRC
+ * @return 帧总长度，缓冲区不足时返回 -1
+ */
+int robot_proto_finish(RobotProtoWriter* w);
+
+/**
+ * @brief 解析一帧（自动识别 v2 帧和旧版 5 字节帧）
+ * @return ROBOT_PROTO_OK 或 RobotProtoError
+ */
+int robot_proto_parse(const uint8_t* data, size_t len, RobotProtoFrame* out);
+
+/**
+ * @brief 遍历 TLV
+ * @param frame 已解析的帧
+ * @param offset 遍历位置，首次调用前置 0
+ * @param tlv 输出
+ * @return 1 取到一个 TLV，0 遍历结束，ROBOT_PROTO_ERR_TLV 越界
+ */
+int robot_proto_next_tlv(const RobotProtoFrame* frame, size_t* offset,
+                         RobotTlv* tlv);
+
+/**
+ * @brief 按路由表分发帧内全部 TLV（未知类型跳过，便于向前兼容）
+ * @return 已处理的 TLV 个数，TLV 越界时返回 ROBOT_PROTO_ERR_TLV
+ *         （越界之前的 TLV 已处理）
+ */
+int robot_proto_dispatch(const RobotProtoFrame* frame,
+                         const RobotProtoRoute* routes, size_t route_num,
+                         void* ctx);
+
+#endif /* ROBOT_PROTO_H */
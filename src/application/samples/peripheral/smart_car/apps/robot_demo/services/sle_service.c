@@ -16,39 +16,21 @@
 /**
  * @file sle_service.c
  * @brief SLE 遥控服务实现 - 复用 UDP 遥控协议
- * @details 协议格式与 UDP 遥控保持一致，确保兼容性
+ * @details 与 UDP 共用 proto_router，支持 v2 帧和旧版 5 字节帧
  */
 
 #include "sle_service.h"
 
 #include "../../../drivers/sle/sle_device.h"
-#include "../core/robot_mgr.h"
 #include "../robot_common.h"
 #include "common_def.h"
 #include "errcode.h"
+#include "proto_router.h"
 #include "soc_osal.h"
 #include "stdio.h"
 
-/* ==================== 协议定义（与 UDP 保持一致） ==================== */
-
-#pragma pack(1)
-typedef struct {
-  uint8_t type;  // 01=控制, 02=状态, 03=模式, 04=PID, FE=心跳, FF=广播
-  uint8_t cmd;
-  int8_t motor1;
-  int8_t motor2;
-  int8_t ir_data;
-} sle_packet_t;
-#pragma pack()
-
 /* ==================== 内部状态 ==================== */
 
-// 命令缓存（与 udp_service 相同的结构）
-static struct {
-  int8_t m1, m2;
-  bool new_data;
-} g_cmd_cache = {0};
-
 // 连接状态
 static bool g_connected = false;
 
@@ -60,48 +42,8 @@ static bool g_connected = false;
  * @param len 数据长度
  */
 static void process_packet(const uint8_t* data, uint16_t len) {
-  if (len < 1) return;
-
-  unused(data[0]);  // type 字段，在 switch 中使用
-
-  // 标准5字节包
-  if (len == sizeof(sle_packet_t)) {
-    const sle_packet_t* pkt = (const sle_packet_t*)data;
-
-    switch (pkt->type) {
-      case 0x01:  // 控制包
-        // 保存到命令缓存
-        g_cmd_cache.m1 = pkt->motor1;
-        g_cmd_cache.m2 = pkt->motor2;
-        g_cmd_cache.new_data = true;
-        printf("[SLE_SRV] 控制命令: m1=%d, m2=%d\r\n", pkt->motor1,
-               pkt->motor2);
-        break;
-
-      case 0x03:  // 模式切换
-        if (pkt->cmd <= 4) {
-          printf("[SLE_SRV] 模式切换: %d\r\n", pkt->cmd);
-          robot_mgr_set_status((CarStatus)pkt->cmd);
-        }
-        break;
-
-      case 0x04:  // PID 设置
-        // PID 设置命令（暂不支持）
-        printf("[SLE_SRV] PID 设置 (暂不支持)\r\n");
-        break;
-
-      case 0xFE:  // 心跳包
-        // 仅用于保活，无需处理
-        break;
-
-      default:
-        printf("[SLE_SRV] 未知包类型: 0x%02X\r\n", pkt->type);
-        break;
-    }
-  } else {
-    printf("[SLE_SRV] 包长度错误: %d (期望 %zu)\r\n", len,
-           sizeof(sle_packet_t));
-  }
+  int ret = proto_router_handle(ROBOT_SRC_SLE, data, len, NULL);
+  if (ret < 0) printf("[SLE_SRV] 数据包无效: 错误 %d, 长度 %d\r\n", ret, len);
 }
 
 /* ==================== SLE 设备回调 ==================== */
@@ -120,12 +62,7 @@ static void sle_connect_callback(uint16_t conn_id) {
  */
 static void sle_disconnect_callback(uint16_t conn_id) {
   unused(conn_id);
-  g_connected = false;
-
-  // 清空命令缓存
-  g_cmd_cache.m1 = 0;
-  g_cmd_cache.m2 = 0;
-  g_cmd_cache.new_data = false;
+  g_connected = false;  // 遥控模式据此忽略 SLE 残留命令
 
   printf("[SLE_SRV] 设备已断开\r\n");
 }
@@ -176,15 +113,3 @@ void sle_service_tick(void) {
 }
 
 bool sle_service_is_connected(void) { return g_connected; }
-
-bool sle_service_pop_cmd(int8_t* motor1_out, int8_t* motor2_out) {
-  if (!g_connected || !g_cmd_cache.new_data) {
-    return false;
-  }
-
-  *motor1_out = g_cmd_cache.m1;
-  *motor2_out = g_cmd_cache.m2;
-  g_cmd_cache.new_data = false;
-
-  return true;
-}
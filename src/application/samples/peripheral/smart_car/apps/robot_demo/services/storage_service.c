@@ -1,7 +1,7 @@
 /**
  * @file        storage_service.c
  * @brief       NV 存储服务实现
- * @details     提供 PID 参数和 WiFi 配置的持久化存储功能
+ * @details     提供 PID 参数、WiFi 配置、红外标定数据和电机整形参数的持久化存储功能
  * @date        2025-02-03
  */
 
@@ -42,7 +42,46 @@ typedef struct {
 #define ROBOT_NV_CONFIG_MAGIC ((uint32_t)0x524F4254)  // "ROBT"
 #define ROBOT_NV_CONFIG_VERSION ((uint16_t)2)
 
+/*
+ * 应用新增记录的 NV 键统一放在用户普通区 [0x5000, 0xFFFF)
+ * (NV_ID_USER_NORMAL_AREA_START)。[0x2000, 0x3000) 为 SDK 系统键区
+ * (key_id.h)，主配置仅为兼容已有数据沿用 0x2000
+ */
+#define ROBOT_NV_USER_KEY_BASE ((uint16_t)0x5000)
+#define ROBOT_NV_IR_PROFILE_KEY ((uint16_t)(ROBOT_NV_USER_KEY_BASE + 1))
+#define ROBOT_NV_MOTOR_KEY ((uint16_t)(ROBOT_NV_USER_KEY_BASE + 2))
+
+/**
+ * @brief 红外标定记录（独立 NV 键，格式升级不影响主配置）
+ */
+typedef struct {
+  uint32_t magic;     // 魔术字 (0x5443524B = "TCRK")
+  uint16_t version;   // 记录版本号
+  uint16_t checksum;  // 16 位校验和（计算时此字段置 0）
+  Tcrt5000Profile profile;
+} robot_nv_ir_profile_t;
+
+#define ROBOT_NV_IR_PROFILE_MAGIC ((uint32_t)0x5443524B)  // "TCRK"
+#define ROBOT_NV_IR_PROFILE_VERSION ((uint16_t)1)
+
+/**
+ * @brief 电机输出整形记录（斜率、死区补偿、单轮修正）
+ */
+typedef struct {
+  uint32_t magic;     // 魔术字 (0x4D4F5452 = "MOTR")
+  uint16_t version;   // 记录版本号
+  uint16_t checksum;  // 16 位校验和（计算时此字段置 0）
+  L9110sShaping shaping;
+} robot_nv_motor_t;
+
+#define ROBOT_NV_MOTOR_MAGIC ((uint32_t)0x4D4F5452)  // "MOTR"
+#define ROBOT_NV_MOTOR_VERSION ((uint16_t)1)
+
 static robot_nv_config_t g_nv_cfg = {0};    /* NV 存储的配置数据 */
+static robot_nv_ir_profile_t g_nv_ir = {0}; /* NV 存储的红外标定数据 */
+static bool g_nv_ir_valid = false;          /* 红外标定数据是否有效 */
+static robot_nv_motor_t g_nv_motor = {0};   /* NV 存储的电机整形参数 */
+static bool g_nv_motor_valid = false;       /* 电机整形参数是否有效 */
 static osal_mutex g_storage_mutex;          /* 保护 NV 存储访问的互斥锁 */
 static bool g_storage_mutex_inited = false; /* 互斥锁是否已初始化 */
 
@@ -104,6 +143,40 @@ static bool nv_validate(robot_nv_config_t* cfg) {
   return saved == calc;
 }
 
+/**
+ * @brief 校验红外标定记录的有效性
+ * @param rec 记录指针
+ * @return true 记录有效
+ */
+static bool nv_ir_validate(robot_nv_ir_profile_t* rec) {
+  if (rec->magic != ROBOT_NV_IR_PROFILE_MAGIC ||
+      rec->version != ROBOT_NV_IR_PROFILE_VERSION) {
+    return false;
+  }
+  uint16_t saved = rec->checksum;
+  rec->checksum = 0;
+  uint16_t calc = nv_checksum16_add((const uint8_t*)rec, sizeof(*rec));
+  rec->checksum = saved;
+  return saved == calc;
+}
+
+/**
+ * @brief 校验电机整形记录的有效性
+ * @param rec 记录指针
+ * @return true 记录有效
+ */
+static bool nv_motor_validate(robot_nv_motor_t* rec) {
+  if (rec->magic != ROBOT_NV_MOTOR_MAGIC ||
+      rec->version != ROBOT_NV_MOTOR_VERSION) {
+    return false;
+  }
+  uint16_t saved = rec->checksum;
+  rec->checksum = 0;
+  uint16_t calc = nv_checksum16_add((const uint8_t*)rec, sizeof(*rec));
+  rec->checksum = saved;
+  return saved == calc;
+}
+
 /**
  * @brief 初始化存储服务互斥锁
  */
@@ -147,6 +220,22 @@ void storage_service_init(void) {
   } else {
     printf("[存储] 加载 NV 配置成功\r\n");
   }
+
+  /* 红外标定为可选记录：不存在时保持未标定，不写默认值 */
+  out_len = 0;
+  ret = uapi_nv_read(ROBOT_NV_IR_PROFILE_KEY, (uint16_t)sizeof(g_nv_ir),
+                     &out_len, (uint8_t*)&g_nv_ir);
+  g_nv_ir_valid = (ret == ERRCODE_SUCC && out_len == sizeof(g_nv_ir) &&
+                   nv_ir_validate(&g_nv_ir));
+  printf("[存储] 红外标定: %s\r\n", g_nv_ir_valid ? "已加载" : "未标定");
+
+  /* 电机整形参数同样为可选记录，不存在时由驱动使用默认值 */
+  out_len = 0;
+  ret = uapi_nv_read(ROBOT_NV_MOTOR_KEY, (uint16_t)sizeof(g_nv_motor),
+                     &out_len, (uint8_t*)&g_nv_motor);
+  g_nv_motor_valid = (ret == ERRCODE_SUCC && out_len == sizeof(g_nv_motor) &&
+                      nv_motor_validate(&g_nv_motor));
+  printf("[存储] 电机整形: %s\r\n", g_nv_motor_valid ? "已加载" : "默认");
   STORAGE_UNLOCK();
 }
 
@@ -231,3 +320,75 @@ errcode_t storage_service_save_wifi_config(const char* ssid,
   STORAGE_UNLOCK();
   return ret;
 }
+
+/**
+ * @brief 获取红外传感器标定数据
+ */
+bool storage_service_get_ir_profile(Tcrt5000Profile* profile) {
+  if (profile == NULL) return false;
+
+  STORAGE_LOCK();
+  bool valid = g_nv_ir_valid;
+  if (valid) *profile = g_nv_ir.profile;
+  STORAGE_UNLOCK();
+  return valid;
+}
+
+/**
+ * @brief 保存红外传感器标定数据到 NV
+ */
+errcode_t storage_service_save_ir_profile(const Tcrt5000Profile* profile) {
+  if (profile == NULL) return ERRCODE_INVALID_PARAM;
+
+  STORAGE_LOCK();
+  g_nv_ir.magic = ROBOT_NV_IR_PROFILE_MAGIC;
+  g_nv_ir.version = ROBOT_NV_IR_PROFILE_VERSION;
+  g_nv_ir.profile = *profile;
+  g_nv_ir.checksum = 0;
+  g_nv_ir.checksum =
+      nv_checksum16_add((const uint8_t*)&g_nv_ir, sizeof(g_nv_ir));
+
+  errcode_t ret = uapi_nv_write(ROBOT_NV_IR_PROFILE_KEY,
+                                (const uint8_t*)&g_nv_ir,
+                                (uint16_t)sizeof(g_nv_ir));
+  g_nv_ir_valid = (ret == ERRCODE_SUCC);
+  printf("[存储] 保存红外标定: 返回值=%d\r\n", ret);
+  STORAGE_UNLOCK();
+  return ret;
+}
+
+/**
+ * @brief 获取电机输出整形参数
+ */
+bool storage_service_get_motor_shaping(L9110sShaping* shaping) {
+  if (shaping == NULL) return false;
+
+  STORAGE_LOCK();
+  bool valid = g_nv_motor_valid;
+  if (valid) *shaping = g_nv_motor.shaping;
+  STORAGE_UNLOCK();
+  return valid;
+}
+
+/**
+ * @brief 保存电机输出整形参数到 NV
+ */
+errcode_t storage_service_save_motor_shaping(const L9110sShaping* shaping) {
+  if (shaping == NULL) return ERRCODE_INVALID_PARAM;
+
+  STORAGE_LOCK();
+  g_nv_motor.magic = ROBOT_NV_MOTOR_MAGIC;
+  g_nv_motor.version = ROBOT_NV_MOTOR_VERSION;
+  g_nv_motor.shaping = *shaping;
+  g_nv_motor.checksum = 0;
+  g_nv_motor.checksum =
+      nv_checksum16_add((const uint8_t*)&g_nv_motor, sizeof(g_nv_motor));
+
+  errcode_t ret = uapi_nv_write(ROBOT_NV_MOTOR_KEY,
+                                (const uint8_t*)&g_nv_motor,
+                                (uint16_t)sizeof(g_nv_motor));
+  g_nv_motor_valid = (ret == ERRCODE_SUCC);
+  printf("[存储] 保存电机整形: 返回值=%d\r\n", ret);
+  STORAGE_UNLOCK();
+  return ret;
+}
@@ -1,8 +1,11 @@
 #ifndef STORAGE_SERVICE_H
 #define STORAGE_SERVICE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "../../../drivers/l9110s/bsp_l9110s.h"
+#include "../../../drivers/tcrt5000/bsp_tcrt5000.h"
 #include "errcode.h"
 
 /**
@@ -47,4 +50,32 @@ void storage_service_get_wifi_config(char* ssid, char* password);
 errcode_t storage_service_save_wifi_config(const char* ssid,
                                            const char* password);
 
+/**
+ * @brief 获取红外传感器标定数据
+ * @param profile 输出标定数据
+ * @return true 存在有效标定，false 未标定（profile 不修改）
+ */
+bool storage_service_get_ir_profile(Tcrt5000Profile* profile);
+
+/**
+ * @brief 保存红外传感器标定数据到 NV
+ * @param profile 标定数据
+ * @return 错误码
+ */
+errcode_t storage_service_save_ir_profile(const Tcrt5000Profile* profile);
+
+/**
+ * @brief 获取电机输出整形参数
+ * @param shaping 输出参数
+ * @return true 存在有效记录，false 未保存过（shaping 不修改）
+ */
+bool storage_service_get_motor_shaping(L9110sShaping* shaping);
+
+/**
+ * @brief 保存电机输出整形参数到 NV
+ * @param shaping 参数
+ * @return 错误码
+ */
+errcode_t storage_service_save_motor_shaping(const L9110sShaping* shaping);
+
 #endif
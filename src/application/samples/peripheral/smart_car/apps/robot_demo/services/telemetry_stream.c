@@ -0,0 +1,322 @@
+/**
+ * @file        telemetry_stream.c
+ * @brief       高频状态流实现
+ * @details     帧内第一个样本相对客户端已确认的快照做增量，其余样本相对帧内
+ *              前一个样本做增量（同一数据报内，丢包不影响解码）。编码时按
+ *              客户端视角重建样本，增量基准与客户端解码结果逐位一致。
+ */
+
+#include "telemetry_stream.h"
+
+#include <string.h>
+
+#define TELEM_HISTORY_MASK (TELEM_HISTORY - 1)
+
+/**
+ * @brief 已发送、等待确认的帧
+ */
+typedef struct {
+  uint16_t seq;          // 帧序号
+  bool valid;            // 是否有效
+  uint64_t sent_ms;      // 发送时刻
+  TelemetrySample last;  // 客户端解码本帧后持有的快照
+} TelemHistory;
+
+static uint8_t g_requested_hz = 0;  // 客户端请求的采样率
+static uint8_t g_rate_hz = 0;       // 当前实际采样率
+static uint64_t g_adjust_ms = 0;    // 上次调整速率的时刻
+static uint64_t g_backoff_ms = 0;   // 上次降速的时刻
+static uint64_t g_key_ms = 0;       // 上次发送关键帧的时刻
+static bool g_key_sent = false;     // 是否已发送过关键帧
+
+static TelemetrySample g_pending[TELEM_MAX_BATCH];  // 待发样本
+static uint64_t g_pending_us[TELEM_MAX_BATCH];      // 待发样本采样时刻
+static uint8_t g_pending_num = 0;
+
+static TelemetrySample g_base;        // 客户端已确认的快照
+static uint16_t g_base_seq = 0;       // 快照所在帧序号
+static bool g_base_valid = false;     // 是否已有确认的快照
+static TelemetrySample g_encoded;     // 最近一次编码帧的末样本（客户端视角）
+static bool g_encoded_valid = false;  // 最近一次编码是否产生了样本
+
+static TelemHistory g_history[TELEM_HISTORY];
+static uint8_t g_history_head = 0;
+
+static TelemetryStats g_stats;
+
+/**
+ * @brief 浮点定标为 int16 并饱和
+ */
+static int16_t telem_scale(float v, float k) {
+  float x = v * k;
+  if (x > 32767.0f) return 32767;
+  if (x < -32768.0f) return -32768;
+  return (int16_t)x;
+}
+
+/**
+ * @brief 距离 (cm) 转为 mm 并饱和到 uint16
+ */
+static uint16_t telem_dist_mm(float cm) {
+  if (!(cm > 0.0f)) return 0;
+  if (cm >= 6553.0f) return 65535;
+  return (uint16_t)(cm * 10.0f + 0.5f);
+}
+
+static void telem_capture(const RobotState* st, TelemetrySample* s) {
+  s->mode = (uint8_t)st->mode;
+  s->ir_bits = (uint8_t)((st->ir_left & 1) | ((st->ir_middle & 1) << 1) |
+                         ((st->ir_right & 1) << 2));
+  s->dist_mm = telem_dist_mm(st->distance);
+  s->adc[0] = st->adc_left;
+  s->adc[1] = st->adc_middle;
+  s->adc[2] = st->adc_right;
+  s->duty[0] = st->duty_left;
+  s->duty[1] = st->duty_right;
+  s->error_milli = telem_scale(st->pid_error, 1000.0f);
+}
+
+static bool telem_adc_changed(uint16_t ref, uint16_t cur) {
+  return (cur > ref ? cur - ref : ref - cur) >= TELEM_ADC_DEADBAND_MV;
+}
+
+/**
+ * @brief 计算相对 ref 的变化掩码，并把 ref 更新为客户端解码后的样本
+ */
+static uint16_t telem_diff(TelemetrySample* ref, const TelemetrySample* cur,
+                           bool full) {
+  uint16_t mask = 0;
+  if (full || cur->mode != ref->mode) mask |= TELEM_F_MODE;
+  if (full || cur->dist_mm != ref->dist_mm) mask |= TELEM_F_DIST;
+  if (full || cur->ir_bits != ref->ir_bits) mask |= TELEM_F_IR;
+  for (int i = 0; i < 3; i++) {
+    if (full || telem_adc_changed(ref->adc[i], cur->adc[i]))
+      mask |= (uint16_t)(TELEM_F_ADC_L << i);
+  }
+  if (full || cur->duty[0] != ref->duty[0]) mask |= TELEM_F_DUTY_L;
+  if (full || cur->duty[1] != ref->duty[1]) mask |= TELEM_F_DUTY_R;
+  if (full || cur->error_milli != ref->error_milli) mask |= TELEM_F_ERROR;
+
+  // 死区内的红外电压保留旧值，其余字段与当前样本一致
+  uint16_t adc[3] = {ref->adc[0], ref->adc[1], ref->adc[2]};
+  for (int i = 0; i < 3; i++) {
+    if (mask & (TELEM_F_ADC_L << i)) adc[i] = cur->adc[i];
+  }
+  *ref = *cur;
+  memcpy(ref->adc, adc, sizeof(adc));
+  return mask;
+}
+
+/**
+ * @brief 按掩码序列化样本字段，返回 value 长度
+ */
+static uint8_t telem_pack(uint8_t* p, uint8_t dt_ms, uint16_t mask,
+                          const TelemetrySample* s) {
+  uint8_t n = 0;
+  p[n++] = dt_ms;
+  robot_proto_put_be16(&p[n], mask);
+  n += 2;
+  if (mask & TELEM_F_MODE) p[n++] = s->mode;
+  if (mask & TELEM_F_DIST) {
+    robot_proto_put_be16(&p[n], s->dist_mm);
+    n += 2;
+  }
+  if (mask & TELEM_F_IR) p[n++] = s->ir_bits;
+  for (int i = 0; i < 3; i++) {
+    if (mask & (TELEM_F_ADC_L << i)) {
+      robot_proto_put_be16(&p[n], s->adc[i]);
+      n += 2;
+    }
+  }
+  if (mask & TELEM_F_DUTY_L) p[n++] = (uint8_t)s->duty[0];
+  if (mask & TELEM_F_DUTY_R) p[n++] = (uint8_t)s->duty[1];
+  if (mask & TELEM_F_ERROR) {
+    robot_proto_put_be16(&p[n], (uint16_t)s->error_milli);
+    n += 2;
+  }
+  return n;
+}
+
+/**
+ * @brief 拥塞：速率减半（TELEM_BACKOFF_HOLD_MS 内只降一次）
+ */
+static void telem_backoff(uint64_t now_ms) {
+  if (g_stats.backoffs > 0 && now_ms - g_backoff_ms < TELEM_BACKOFF_HOLD_MS)
+    return;
+  g_rate_hz = g_rate_hz > 1 ? g_rate_hz / 2 : 1;
+  g_backoff_ms = now_ms;
+  g_adjust_ms = now_ms;
+  g_stats.backoffs++;
+}
+
+/**
+ * @brief 无拥塞持续 TELEM_RECOVER_MS 后回升请求速率的 1/10
+ */
+static void telem_recover(uint64_t now_ms) {
+  if (g_rate_hz >= g_requested_hz) return;
+  if (now_ms - g_adjust_ms < TELEM_RECOVER_MS) return;
+  uint8_t step = g_requested_hz / 10 > 0 ? g_requested_hz / 10 : 1;
+  g_rate_hz = (uint8_t)(g_requested_hz - g_rate_hz > step ? g_rate_hz + step
+                                                           : g_requested_hz);
+  g_adjust_ms = now_ms;
+}
+
+/**
+ * @brief 本帧合并的样本数：保证每秒数据报数不超过 TELEM_TX_MAX_HZ
+ */
+static uint8_t telem_batch(void) {
+  uint8_t n = (uint8_t)((g_rate_hz + TELEM_TX_MAX_HZ - 1) / TELEM_TX_MAX_HZ);
+  if (n < 1) n = 1;
+  return n > TELEM_MAX_BATCH ? TELEM_MAX_BATCH : n;
+}
+
+void telemetry_stream_reset(void) {
+  g_requested_hz = 0;
+  g_rate_hz = 0;
+  g_pending_num = 0;
+  g_base_valid = false;
+  g_encoded_valid = false;
+  g_key_sent = false;
+  memset(g_history, 0, sizeof(g_history));
+  g_history_head = 0;
+  g_stats.requested_hz = 0;
+  g_stats.rate_hz = 0;
+  g_stats.srtt_ms = 0;
+}
+
+void telemetry_stream_set_rate(uint8_t hz, uint64_t now_ms) {
+  if (hz > TELEM_RATE_MAX_HZ) hz = TELEM_RATE_MAX_HZ;
+  if (hz == g_requested_hz) return;  // 客户端周期性重复请求，不打断自适应
+
+  if (hz == 0) {
+    telemetry_stream_reset();
+    return;
+  }
+  g_requested_hz = hz;
+  if (g_rate_hz == 0 || g_rate_hz > hz) g_rate_hz = hz;
+  g_adjust_ms = now_ms;
+}
+
+bool telemetry_stream_active(void) { return g_rate_hz > 0; }
+
+uint32_t telemetry_stream_period_ms(void) {
+  return g_rate_hz > 0 ? 1000u / g_rate_hz : 0;
+}
+
+bool telemetry_stream_sample(const RobotState* state, uint64_t now_ms) {
+  if (g_rate_hz == 0 || state == NULL) return false;
+
+  telem_recover(now_ms);
+  if (g_pending_num >= TELEM_MAX_BATCH) {
+    // 上一帧未能发出，丢弃最旧的样本
+    memmove(&g_pending[0], &g_pending[1],
+            (TELEM_MAX_BATCH - 1) * sizeof(g_pending[0]));
+    memmove(&g_pending_us[0], &g_pending_us[1],
+            (TELEM_MAX_BATCH - 1) * sizeof(g_pending_us[0]));
+    g_pending_num--;
+  }
+  telem_capture(state, &g_pending[g_pending_num]);
+  g_pending_us[g_pending_num] = state->timestamp_us;
+  g_pending_num++;
+  return g_pending_num >= telem_batch();
+}
+
+uint64_t telemetry_stream_first_us(void) {
+  return g_pending_num > 0 ? g_pending_us[0] : 0;
+}
+
+int telemetry_stream_encode(RobotProtoWriter* w) {
+  g_encoded_valid = false;
+  if (g_pending_num == 0) return 0;
+
+  // 无确认快照或距上次关键帧过久时发送全量关键帧
+  uint64_t now_ms = g_pending_us[0] / 1000;
+  bool key = !g_base_valid || !g_key_sent ||
+             now_ms - g_key_ms >= TELEM_KEYFRAME_MS;
+  TelemetrySample ref = g_base;
+  if (!key) {
+    uint8_t base[2];
+    robot_proto_put_be16(base, g_base_seq);
+    if (robot_proto_put(w, ROBOT_TLV_TELEM_BASE, base, sizeof(base)) != 0)
+      return 0;
+  }
+
+  int n = 0;
+  uint8_t value[3 + sizeof(TelemetrySample) + 2];
+  for (; n < g_pending_num; n++) {
+    uint64_t dt_us = g_pending_us[n] - g_pending_us[0];
+    uint8_t dt_ms = dt_us / 1000 > 255 ? 255 : (uint8_t)(dt_us / 1000);
+    TelemetrySample next = ref;
+    uint16_t mask = telem_diff(&next, &g_pending[n], key && n == 0);
+    uint8_t len = telem_pack(value, dt_ms, mask, &g_pending[n]);
+    if (robot_proto_put(w, ROBOT_TLV_TELEM_SAMPLE, value, len) != 0) break;
+    ref = next;
+  }
+  if (n == 0) return 0;
+
+  if (key) {
+    g_key_ms = now_ms;
+    g_key_sent = true;
+  }
+  g_encoded = ref;
+  g_encoded_valid = true;
+
+  // 放不下的样本留到下一帧
+  g_pending_num = (uint8_t)(g_pending_num - n);
+  memmove(&g_pending[0], &g_pending[n], g_pending_num * sizeof(g_pending[0]));
+  memmove(&g_pending_us[0], &g_pending_us[n],
+          g_pending_num * sizeof(g_pending_us[0]));
+  g_stats.samples += (uint32_t)n;
+  return n;
+}
+
+void telemetry_stream_on_sent(uint16_t seq, int sent, uint64_t now_ms) {
+  if (sent <= 0) {
+    g_stats.send_fails++;
+    telem_backoff(now_ms);
+    g_encoded_valid = false;
+    return;
+  }
+  g_stats.frames++;
+  g_stats.bytes += (uint32_t)sent;
+  if (!g_encoded_valid) return;
+
+  TelemHistory* h = &g_history[g_history_head & TELEM_HISTORY_MASK];
+  g_history_head++;
+  h->seq = seq;
+  h->valid = true;
+  h->sent_ms = now_ms;
+  h->last = g_encoded;
+  g_encoded_valid = false;
+}
+
+void telemetry_stream_on_ack(uint16_t seq, uint64_t now_ms) {
+  // 只接受比当前基准新的确认，避免乱序确认使基准回退
+  if (g_base_valid && (int16_t)(seq - g_base_seq) <= 0) return;
+
+  for (int i = 0; i < TELEM_HISTORY; i++) {
+    TelemHistory* h = &g_history[i];
+    if (!h->valid || h->seq != seq) continue;
+
+    g_base = h->last;
+    g_base_seq = seq;
+    g_base_valid = true;
+    h->valid = false;
+    g_stats.acks++;
+
+    uint64_t elapsed = now_ms - h->sent_ms;
+    uint32_t rtt = elapsed > 0xFFFF ? 0xFFFF : (uint32_t)elapsed;
+    g_stats.srtt_ms = g_stats.srtt_ms == 0
+                          ? (uint16_t)rtt
+                          : (uint16_t)((g_stats.srtt_ms * 7u + rtt) / 8u);
+    if (rtt > TELEM_RTT_HIGH_MS) telem_backoff(now_ms);
+    return;
+  }
+}
+
+void telemetry_stream_get_stats(TelemetryStats* out) {
+  if (!out) return;
+  *out = g_stats;
+  out->requested_hz = g_requested_hz;
+  out->rate_hz = g_rate_hz;
+}
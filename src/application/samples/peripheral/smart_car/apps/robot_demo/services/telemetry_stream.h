@@ -0,0 +1,126 @@
+/**
+ * @file        telemetry_stream.h
+ * @brief       高频状态流：增量编码 + 多样本合帧 + 自适应速率
+ * @details     客户端通过 v2 STREAM TLV 选择采样率 (1~100Hz)。每个样本只携带
+ *              相对"客户端最近确认的快照"发生变化的字段，多个样本合并进一个
+ *              数据报（每秒最多 TELEM_TX_MAX_HZ 个）。客户端用 ACK TLV 确认
+ *              帧序号，小车据此推进增量基准并测量往返时间；发送失败
+ *              （lwIP 缓冲区耗尽）或 RTT 过高时速率减半，恢复后逐步回升。
+ *              仅由 UDP 任务调用，不加锁。
+ */
+
+#ifndef TELEMETRY_STREAM_H
+#define TELEMETRY_STREAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../robot_common.h"
+#include "robot_proto.h"
+
+#define TELEM_RATE_MAX_HZ 100      // 客户端可选的最高采样率
+#define TELEM_TX_MAX_HZ 20         // 每秒最多发送的数据报数，超出部分合帧
+#define TELEM_MAX_BATCH 5          // 单帧最多合并的样本数（受帧长限制）
+#define TELEM_HISTORY 16           // 等待确认的已发送帧记录数（2 的幂）
+#define TELEM_KEYFRAME_MS 2000     // 关键帧（全量、不引用基准）最大间隔
+#define TELEM_RTT_HIGH_MS 150      // 单次 RTT 超过该值视为拥塞
+#define TELEM_BACKOFF_HOLD_MS 500  // 两次降速之间的最小间隔
+#define TELEM_RECOVER_MS 1000      // 无拥塞持续该时间后回升一档
+#define TELEM_ADC_DEADBAND_MV 8    // 红外电压变化小于该值时不发送
+
+// 样本字段掩码（SAMPLE TLV 中按位序排列，置位的字段才携带）
+#define TELEM_F_MODE 0x0001      // u8  当前模式
+#define TELEM_F_DIST 0x0002      // u16 超声波距离 (mm)
+#define TELEM_F_IR 0x0004        // u8  红外 bits (Bit0 左, Bit1 中, Bit2 右)
+#define TELEM_F_ADC_L 0x0008     // u16 左红外电压 (mV)
+#define TELEM_F_ADC_M 0x0010     // u16 中红外电压 (mV)
+#define TELEM_F_ADC_R 0x0020     // u16 右红外电压 (mV)
+#define TELEM_F_DUTY_L 0x0040    // i8  左轮占空比
+#define TELEM_F_DUTY_R 0x0080    // i8  右轮占空比
+#define TELEM_F_ERROR 0x0100     // i16 循迹误差 × 1000
+#define TELEM_F_ALL 0x01FF
+
+/**
+ * @brief 一个状态样本（线上单位）
+ */
+typedef struct {
+  uint8_t mode;
+  uint8_t ir_bits;
+  uint16_t dist_mm;
+  uint16_t adc[3];
+  int8_t duty[2];
+  int16_t error_milli;
+} TelemetrySample;
+
+/**
+ * @brief 流统计
+ */
+typedef struct {
+  uint8_t requested_hz;  // 客户端请求的采样率，0 表示关闭
+  uint8_t rate_hz;       // 当前实际采样率（拥塞时低于请求值）
+  uint16_t srtt_ms;      // 平滑 RTT，0 表示尚无样本
+  uint32_t frames;       // 已发送帧数
+  uint32_t samples;      // 已发送样本数
+  uint32_t bytes;        // 已发送字节数
+  uint32_t acks;         // 有效确认数
+  uint32_t send_fails;   // 发送失败次数
+  uint32_t backoffs;     // 降速次数
+} TelemetryStats;
+
+/**
+ * @brief 清空流状态并关闭（连接建立 / 断开 / 对端变化时调用）
+ */
+void telemetry_stream_reset(void);
+
+/**
+ * @brief 设置客户端请求的采样率
+ * @param hz 0 关闭，超过 TELEM_RATE_MAX_HZ 时截断
+ */
+void telemetry_stream_set_rate(uint8_t hz, uint64_t now_ms);
+
+/**
+ * @brief 是否正在推流
+ */
+bool telemetry_stream_active(void);
+
+/**
+ * @brief 当前采样周期 (ms)，未推流时返回 0
+ */
+uint32_t telemetry_stream_period_ms(void);
+
+/**
+ * @brief 采样一次
+ * @return true 待发样本已达本帧合并数，应立即组帧发送
+ */
+bool telemetry_stream_sample(const RobotState* state, uint64_t now_ms);
+
+/**
+ * @brief 将待发样本编码进帧（帧头时间戳应为 telemetry_stream_first_us）
+ * @return 写入的样本数
+ */
+int telemetry_stream_encode(RobotProtoWriter* w);
+
+/**
+ * @brief 待发样本中第一个的采样时刻 (us)
+ */
+uint64_t telemetry_stream_first_us(void);
+
+/**
+ * @brief 记录一帧的发送结果（用于确认匹配、RTT 测量和拥塞判断）
+ * @param seq 帧序号
+ * @param sent lwip_sendto 返回值，<= 0 表示发送失败
+ */
+void telemetry_stream_on_sent(uint16_t seq, int sent, uint64_t now_ms);
+
+/**
+ * @brief 处理客户端确认
+ * @param seq 客户端已完整解码的帧序号
+ */
+void telemetry_stream_on_ack(uint16_t seq, uint64_t now_ms);
+
+/**
+ * @brief 读取统计
+ */
+void telemetry_stream_get_stats(TelemetryStats* out);
+
+#endif /* TELEMETRY_STREAM_H */
@@ -10,25 +10,35 @@
 #include <string.h>
 
 #include "../../../drivers/wifi_client/bsp_wifi.h"
-#include "../core/mode_trace.h"
+#include "../core/robot_config.h"
 #include "../core/robot_mgr.h"
 #include "lwip/inet.h"
 #include "lwip/sockets.h"
 #include "securec.h"
+#include "flight_recorder.h"
+#include "proto_router.h"
+#include "robot_proto.h"
 #include "storage_service.h"
+#include "tcxo.h"
+#include "telemetry_stream.h"
 #include "udp_net_common.h"
 
 /* --- 配置常量 --- */
 #define BROADCAST_INTERVAL_MS 500  // 寻找期：高频广播，快速被发现
 #define CONNECTED_HEART_MS 2000    // 连接期：低频心跳
 #define TIMEOUT_LIMIT_MS 5000      // 增加容错到 5秒，防止网络抖动导致的误判
-#define UDP_RECV_TIMEOUT_MS 10     // 接收阻塞时间 (短时间，保证循环响应)
+#define WIFI_CHECK_MS 2000         // WiFi 状态维护周期
+#define KEEPALIVE_DECAY_MS 1000    // 容错计次衰减周期
 #define KEEPALIVE_MAX_COUNT 3      // 容错计次：连续3次未收到心跳才判定断连
+#define LEGACY_DIST_MAX_MM 127     // 旧版状态包距离字段 (int8) 上限
+#define UDP_RX_BURST 8             // 每次唤醒最多连续读取的包数
+#define UDP_SELECT_RETRY_MS 100    // select 出错时的退避时间
+#define UDP_PEER_READ_RETRY 4      // 读者遇到写入中的对端地址时的重试次数
 
 /* --- 协议定义 --- */
 #pragma pack(1)
 typedef struct {
-  uint8_t type;  // 01=控制, 02=状态, 03=模式, 04=PID, FE=心跳, FF=广播
+  uint8_t type;  // 旧版 5 字节帧：02=状态, FE=心跳（v2 见 robot_proto.h）
   uint8_t cmd;
   int8_t motor1;
   int8_t motor2;
@@ -44,30 +54,70 @@ typedef struct {
 
 /* --- 全局变量 --- */
 static int g_sockfd = -1;
-static osal_mutex g_cmd_mutex;
-
-// 命令缓存
-static struct {
-  int8_t m1, m2;
-  bool new_data;
-} g_cmd_cache = {0};
 
 // 连接状态管理
 static struct sockaddr_in g_server_addr;  // 当前绑定的控制器地址
 static bool g_is_connected = false;       // 是否处于已连接状态
 static uint64_t g_last_recv_time = 0;     // 最后一次收到数据的时间
 static uint8_t g_keepalive_count = KEEPALIVE_MAX_COUNT;  // 容错计次（生命值）
+static bool g_peer_v2 = false;  // 对端最近一帧为 v2 协议，回复也用 v2
+static uint16_t g_tx_seq = 0;   // v2 上行帧序号
+
+/*
+ * 供其他任务发送用的对端地址
+ * - g_server_addr 只由 UDP 任务读写；变化后由 peer_publish 同步到这里
+ * - 带序号的单写者槽位，读者读前后序号一致即为同一地址，从不等待写者
+ */
+static struct {
+  volatile uint32_t seq;  // 奇数表示正在写入
+  uint32_t s_addr;
+  uint16_t sin_port;
+} g_peer;
 
 // 发现包管理
 static discovery_packet_t g_discovery_pkt;
 static bool g_discovery_ready = false;  // 发现包是否已构建(MAC是否获取)
+static bool g_wifi_ready = false;       // WiFi 已连接且已获取 IP
+
+/* --- 定时器集合 --- */
+typedef enum {
+  UDP_TIMER_WIFI = 0,   // WiFi 状态维护（常驻）
+  UDP_TIMER_KEEPALIVE,  // 容错计次衰减（连接期）
+  UDP_TIMER_BROADCAST,  // 发现包广播（寻找期）
+  UDP_TIMER_TELEMETRY,  // 状态流 / 心跳上报（连接期，周期随状态流速率变化）
+  UDP_TIMER_NUM
+} UdpTimerId;
+
+typedef struct {
+  uint32_t period_ms;    // 周期
+  uint64_t deadline_ms;  // 下次到期时刻 (TCXO ms)
+  bool active;           // 是否在运行
+  void (*handler)(uint64_t now_ms);
+} UdpTimer;
+
+static void on_wifi_timer(uint64_t now_ms);
+static void on_keepalive_timer(uint64_t now_ms);
+static void on_broadcast_timer(uint64_t now_ms);
+static void on_telemetry_timer(uint64_t now_ms);
+
+static UdpTimer g_timers[UDP_TIMER_NUM] = {
+    [UDP_TIMER_WIFI] = {WIFI_CHECK_MS, 0, true, on_wifi_timer},
+    [UDP_TIMER_KEEPALIVE] = {KEEPALIVE_DECAY_MS, 0, false, on_keepalive_timer},
+    [UDP_TIMER_BROADCAST] = {BROADCAST_INTERVAL_MS, 0, false,
+                             on_broadcast_timer},
+    [UDP_TIMER_TELEMETRY] = {CONNECTED_HEART_MS, 0, false, on_telemetry_timer},
+};
+
+static UdpLoopStats g_loop_stats;  // 事件循环统计（仅 UDP 任务写）
 
 /* --- 内部函数声明 --- */
 static void* udp_service_task(const char* arg);
-static void handle_udp_receive(void);
+static void handle_udp_receive(uint64_t now_ms);
 static void process_packet(uint8_t* data, size_t len,
                            struct sockaddr_in* sender);
 static void build_discovery_packet(void);
+static void send_robot_state_or_heartbeat(void);
+static void send_telemetry_frame(uint64_t now_ms);
 
 /* -------------------------------------------------------------------------- */
 /* 外部接口实现                                      */
@@ -75,7 +125,6 @@ static void build_discovery_packet(void);
 
 void udp_service_init(void) {
   udp_net_common_init();
-  osal_mutex_init(&g_cmd_mutex);
 
   // 创建线程
   osal_task* task = osal_kthread_create((osal_kthread_handler)udp_service_task,
@@ -93,25 +142,91 @@ WifiConnectStatus udp_service_get_wifi_status(void) {
 
 const char* udp_service_get_ip(void) { return g_udp_net_ip; }
 
-void udp_service_push_cmd(int8_t m1, int8_t m2) {
-  osal_mutex_lock(&g_cmd_mutex);
-  g_cmd_cache.m1 = m1;
-  g_cmd_cache.m2 = m2;
-  g_cmd_cache.new_data = true;
-  osal_mutex_unlock(&g_cmd_mutex);
+void udp_service_get_loop_stats(UdpLoopStats* out) {
+  if (out) *out = g_loop_stats;
+}
+
+/**
+ * @brief 每秒次数，保留一位小数（x10）
+ */
+static uint32_t rate_x10(uint32_t delta, uint32_t elapsed_ms) {
+  return (uint32_t)((uint64_t)delta * 10000u / elapsed_ms);
 }
 
-bool udp_service_pop_cmd(int8_t* m1, int8_t* m2) {
-  bool ret = false;
-  osal_mutex_lock(&g_cmd_mutex);
-  if (g_cmd_cache.new_data) {
-    *m1 = g_cmd_cache.m1;
-    *m2 = g_cmd_cache.m2;
-    g_cmd_cache.new_data = false;
-    ret = true;
+void udp_service_dump_stats(void) {
+  static UdpLoopStats last;
+  static uint64_t last_ms = 0;
+  UdpLoopStats st = g_loop_stats;
+  uint64_t now = uapi_tcxo_get_ms();
+  uint32_t elapsed = (uint32_t)(now - last_ms);
+
+  if (last_ms != 0 && elapsed > 0) {
+    const char* phase = g_is_connected ? "已连接"
+                        : g_wifi_ready ? "寻找"
+                                       : "WiFi未就绪";
+    uint32_t wake = rate_x10(st.wakeups - last.wakeups, elapsed);
+    uint32_t rx = rate_x10(st.rx_wakeups - last.rx_wakeups, elapsed);
+    uint32_t tmr = rate_x10(st.timer_runs - last.timer_runs, elapsed);
+    printf("[UDP] %s 唤醒:%u.%u/s (收包:%u.%u/s 定时器:%u.%u/s) "
+           "收包:%u select错误:%u\r\n",
+           phase, (unsigned)(wake / 10), (unsigned)(wake % 10),
+           (unsigned)(rx / 10), (unsigned)(rx % 10), (unsigned)(tmr / 10),
+           (unsigned)(tmr % 10), (unsigned)st.rx_packets,
+           (unsigned)st.select_errors);
   }
-  osal_mutex_unlock(&g_cmd_mutex);
-  return ret;
+  last = st;
+  last_ms = now;
+
+  TelemetryStats ts;
+  telemetry_stream_get_stats(&ts);
+  if (ts.requested_hz > 0)
+    printf("[UDP] 状态流 请求:%uHz 实际:%uHz RTT:%ums 帧:%u 样本:%u "
+           "字节:%u 确认:%u 失败:%u 降速:%u\r\n",
+           ts.requested_hz, ts.rate_hz, ts.srtt_ms, (unsigned)ts.frames,
+           (unsigned)ts.samples, (unsigned)ts.bytes, (unsigned)ts.acks,
+           (unsigned)ts.send_fails, (unsigned)ts.backoffs);
+}
+
+/**
+ * @brief 发布对端地址（仅 UDP 任务在 g_server_addr 变化后调用）
+ */
+static void peer_publish(void) {
+  g_peer.seq++;  // 奇数：写入中
+  ROBOT_MEMORY_BARRIER();
+  g_peer.s_addr = g_server_addr.sin_addr.s_addr;
+  g_peer.sin_port = g_server_addr.sin_port;
+  ROBOT_MEMORY_BARRIER();
+  g_peer.seq++;  // 偶数：写入完成
+}
+
+/**
+ * @brief 读取一份完整的对端地址
+ * @return true 已连接且读到完整地址
+ */
+static bool peer_snapshot(struct sockaddr_in* out) {
+  for (int i = 0; i < UDP_PEER_READ_RETRY; i++) {
+    uint32_t seq = g_peer.seq;
+    ROBOT_MEMORY_BARRIER();
+    if (seq & 1u) continue;
+    uint32_t s_addr = g_peer.s_addr;
+    uint16_t sin_port = g_peer.sin_port;
+    ROBOT_MEMORY_BARRIER();
+    if (g_peer.seq != seq) continue;
+    if (s_addr == 0 || sin_port == 0) return false;  // 未连接
+
+    memset_s(out, sizeof(*out), 0, sizeof(*out));
+    out->sin_family = AF_INET;
+    out->sin_addr.s_addr = s_addr;
+    out->sin_port = sin_port;
+    return true;
+  }
+  return false;
+}
+
+int udp_service_send_to_peer(const void* buf, size_t len) {
+  struct sockaddr_in peer;
+  if (g_sockfd < 0 || !peer_snapshot(&peer)) return -1;
+  return udp_net_common_send_to_addr(buf, len, &peer);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -156,60 +271,193 @@ static void process_packet(uint8_t* data, size_t len,
     return;
   }
 
-  // 标准5字节包
-  if (len == sizeof(udp_packet_t)) {
-    udp_packet_t* pkt = (udp_packet_t*)data;
-    switch (pkt->type) {
-      case 0x01:  // 控制
-        udp_service_push_cmd(pkt->motor1, pkt->motor2);
-        break;
-      case 0x03:  // 模式
-        if (pkt->cmd <= 4) robot_mgr_set_status((CarStatus)pkt->cmd);
-        break;
-      case 0x04:  // PID
-        mode_trace_set_pid(
-            pkt->cmd, (int16_t)((pkt->motor1 << 8) | (uint8_t)pkt->motor2));
-        break;
-      case 0xFE:  // 心跳包
-        // 仅用于刷新超时时间，无其他业务逻辑
-        break;
-    }
+  // v2 帧或旧版 5 字节帧，统一按 TLV 路由；对端用什么版本就回复什么版本
+  RobotProtoFrame frame;
+  if (proto_router_handle(ROBOT_SRC_UDP, data, len, &frame) >= 0)
+    g_peer_v2 = !frame.legacy;
+}
+
+/**
+ * @brief 启动定时器，首次在 delay_ms 后到期
+ */
+static void timer_start(UdpTimerId id, uint64_t now_ms, uint32_t delay_ms) {
+  g_timers[id].active = true;
+  g_timers[id].deadline_ms = now_ms + delay_ms;
+}
+
+static void timer_stop(UdpTimerId id) { g_timers[id].active = false; }
+
+/**
+ * @brief 执行所有已到期的定时器（处理函数内可启停其他定时器）
+ */
+static void timers_run(uint64_t now_ms) {
+  for (int i = 0; i < UDP_TIMER_NUM; i++) {
+    UdpTimer* t = &g_timers[i];
+    if (!t->active || now_ms < t->deadline_ms) continue;
+    // 按周期推进；落后超过一个周期（如 WiFi 连接阻塞）时从当前时刻重新对齐
+    t->deadline_ms += t->period_ms;
+    if (t->deadline_ms <= now_ms) t->deadline_ms = now_ms + t->period_ms;
+    t->handler(now_ms);
+    g_loop_stats.timer_runs++;
   }
 }
 
 /**
- * @brief 接收处理
+ * @brief 距最近一个定时器到期的时间 (ms)
  */
-static void handle_udp_receive(void) {
-  uint8_t buf[128];
-  struct sockaddr_in client_addr;
-  socklen_t addr_len = sizeof(client_addr);
+static uint32_t timers_next_wait(uint64_t now_ms) {
+  uint32_t wait = WIFI_CHECK_MS;  // WiFi 定时器常驻，等待时间不会超过其周期
+  for (int i = 0; i < UDP_TIMER_NUM; i++) {
+    const UdpTimer* t = &g_timers[i];
+    if (!t->active) continue;
+    if (t->deadline_ms <= now_ms) return 0;
+    if (t->deadline_ms - now_ms < wait)
+      wait = (uint32_t)(t->deadline_ms - now_ms);
+  }
+  return wait;
+}
+
+/**
+ * @brief 断开连接，切回广播模式
+ */
+static void enter_discovery(uint64_t now_ms) {
+  g_is_connected = false;
+  g_keepalive_count = KEEPALIVE_MAX_COUNT;
+  memset_s(&g_server_addr, sizeof(g_server_addr), 0, sizeof(g_server_addr));
+  peer_publish();
+  telemetry_stream_reset();
+  timer_stop(UDP_TIMER_TELEMETRY);
+  timer_stop(UDP_TIMER_KEEPALIVE);
+  if (g_wifi_ready) timer_start(UDP_TIMER_BROADCAST, now_ms, 0);
+}
+
+/**
+ * @brief WiFi 状态维护
+ */
+static void on_wifi_timer(uint64_t now_ms) {
+  udp_net_common_wifi_ensure_connected();
+
+  bool ready = g_udp_net_wifi_connected && g_udp_net_wifi_has_ip;
+  if (ready == g_wifi_ready) return;
+  g_wifi_ready = ready;
+
+  if (ready) {
+    // 延迟构建广播包 (确保有MAC)，失败时由广播定时器重试
+    build_discovery_packet();
+    timer_start(UDP_TIMER_BROADCAST, now_ms, 0);
+  } else {
+    // WiFi未就绪，重置状态
+    g_discovery_ready = false;
+    enter_discovery(now_ms);
+    timer_stop(UDP_TIMER_BROADCAST);
+  }
+}
+
+/**
+ * @brief 容错计次衰减：每秒减少一次生命值，耗尽才真正断连
+ */
+static void on_keepalive_timer(uint64_t now_ms) {
+  if (!g_is_connected || g_keepalive_count == 0) return;
+  if (--g_keepalive_count > 0) return;
 
-  // 非阻塞接收
-  int n = lwip_recvfrom(g_sockfd, buf, sizeof(buf), 0,
-                        (struct sockaddr*)&client_addr, &addr_len);
+  printf("[UDP] 连接超时 (5s内未收到心跳)，切回广播模式\r\n");
+  enter_discovery(now_ms);
+  if (flight_recorder_is_enabled()) flight_recorder_set_enabled(false);
+}
 
-  if (n > 0) {
-    uint64_t now = osal_get_jiffies();
+/**
+ * @brief 寻找期：高频广播发现包 (500ms)
+ */
+static void on_broadcast_timer(uint64_t now_ms) {
+  (void)now_ms;
+  if (!g_discovery_ready) build_discovery_packet();
+  if (g_discovery_ready)
+    udp_net_common_send_broadcast(&g_discovery_pkt, sizeof(g_discovery_pkt),
+                                  UDP_BROADCAST_PORT);
+}
+
+/**
+ * @brief 上报定时器周期跟随状态流速率：推流时为采样周期，否则为心跳周期
+ */
+static void telemetry_timer_sync(uint64_t now_ms) {
+  if (!g_is_connected) return;
+  uint32_t period = telemetry_stream_period_ms();
+  if (period == 0) period = CONNECTED_HEART_MS;
+  if (g_timers[UDP_TIMER_TELEMETRY].period_ms == period) return;
+
+  g_timers[UDP_TIMER_TELEMETRY].period_ms = period;
+  timer_start(UDP_TIMER_TELEMETRY, now_ms, period);
+}
+
+/**
+ * @brief 连接期：v2 对端开启状态流时按采样率上报（状态帧兼作心跳），
+ *        否则低频状态 / 心跳上报 (2s)
+ */
+static void on_telemetry_timer(uint64_t now_ms) {
+  if (g_peer_v2 && telemetry_stream_active()) {
+    RobotState curr;
+    robot_mgr_get_state_copy(&curr);
+    if (telemetry_stream_sample(&curr, now_ms)) send_telemetry_frame(now_ms);
+  } else {
+    send_robot_state_or_heartbeat();
+  }
+  // 拥塞降速 / 恢复会改变采样周期
+  telemetry_timer_sync(now_ms);
+}
+
+/**
+ * @brief 接收处理（select 报告可读后调用，一次取完已到达的包）
+ */
+static void handle_udp_receive(uint64_t now_ms) {
+  uint8_t buf[128];
+
+  for (int i = 0; i < UDP_RX_BURST; i++) {
+    struct sockaddr_in client_addr;
+    socklen_t addr_len = sizeof(client_addr);
+    int n = lwip_recvfrom(g_sockfd, buf, sizeof(buf), MSG_DONTWAIT,
+                          (struct sockaddr*)&client_addr, &addr_len);
+    if (n <= 0) break;
+    g_loop_stats.rx_packets++;
 
     // --- 单向触发重连：只要收到服务端任何指令包，立即进入连接态 ---
     if (!g_is_connected ||
         client_addr.sin_addr.s_addr != g_server_addr.sin_addr.s_addr ||
         client_addr.sin_port != g_server_addr.sin_port) {
+      // 新的对端需要重新请求状态流
+      telemetry_stream_reset();
+      if (!g_is_connected) {
+        // 停止广播，开始上报和容错计次衰减
+        timer_stop(UDP_TIMER_BROADCAST);
+        g_timers[UDP_TIMER_TELEMETRY].period_ms = CONNECTED_HEART_MS;
+        timer_start(UDP_TIMER_TELEMETRY, now_ms, CONNECTED_HEART_MS);
+        timer_start(UDP_TIMER_KEEPALIVE, now_ms, KEEPALIVE_DECAY_MS);
+      }
       g_is_connected = true;
       memcpy_s(&g_server_addr, sizeof(g_server_addr), &client_addr,
                sizeof(client_addr));
+      peer_publish();
       printf("[UDP] 建立连接/更新地址: %s\r\n",
              inet_ntoa(client_addr.sin_addr));
     }
 
     // 重置容错计次（生命值回满）
     g_keepalive_count = KEEPALIVE_MAX_COUNT;
-    g_last_recv_time = now;
+    g_last_recv_time = osal_get_jiffies();
 
     // 处理数据包
     process_packet(buf, (size_t)n, &client_addr);
   }
+  // STREAM 命令可能改变了采样率
+  telemetry_timer_sync(now_ms);
+}
+
+/**
+ * @brief 距离 (cm) 转为 mm，负值和无效值记 0，超出 uint16 时饱和
+ */
+static uint16_t distance_to_mm(float distance_cm) {
+  if (!(distance_cm > 0.0f)) return 0;
+  float mm = distance_cm * 10.0f + 0.5f;
+  return mm >= 65535.0f ? 65535 : (uint16_t)mm;
 }
 
 /**
@@ -229,18 +477,47 @@ static void send_robot_state_or_heartbeat(void) {
                   curr.ir_middle != last_sent_state.ir_middle ||
                   curr.ir_right != last_sent_state.ir_right);
 
+  if (changed) last_sent_state = curr;
+
+  uint16_t dist_mm = distance_to_mm(curr.distance);
+  uint8_t ir_bits = (curr.ir_left & 1) | ((curr.ir_middle & 1) << 1) |
+                    ((curr.ir_right & 1) << 2);
+
+  if (g_peer_v2) {
+    // v2：状态、红外电压、电机占空比批量打包进同一帧
+    uint8_t buf[ROBOT_PROTO_MAX_FRAME];
+    RobotProtoWriter w;
+    robot_proto_begin(&w, buf, sizeof(buf), ROBOT_PROTO_FLAG_UPLINK,
+                      g_tx_seq++, (uint32_t)uapi_tcxo_get_us());
+    if (changed) {
+      uint8_t status[4] = {curr.mode, 0, 0, ir_bits};
+      robot_proto_put_be16(&status[1], dist_mm);
+      uint8_t adc[6];
+      robot_proto_put_be16(&adc[0], curr.adc_left);
+      robot_proto_put_be16(&adc[2], curr.adc_middle);
+      robot_proto_put_be16(&adc[4], curr.adc_right);
+      int8_t duty[2] = {curr.duty_left, curr.duty_right};
+      (void)robot_proto_put(&w, ROBOT_TLV_STATUS, status, sizeof(status));
+      (void)robot_proto_put(&w, ROBOT_TLV_LINE_ADC, adc, sizeof(adc));
+      (void)robot_proto_put(&w, ROBOT_TLV_MOTOR, duty, sizeof(duty));
+    } else {
+      (void)robot_proto_put(&w, ROBOT_TLV_HEARTBEAT, NULL, 0);
+    }
+    int n = robot_proto_finish(&w);
+    if (n > 0) udp_net_common_send_to_addr(buf, (size_t)n, &g_server_addr);
+    return;
+  }
+
   udp_packet_t pkt = {0};
 
   if (changed) {
-    // 发送状态包 (Type 0x02)
+    // 发送状态包 (Type 0x02)，旧版距离字段为 int8，超出量程时饱和
     pkt.type = 0x02;
     pkt.cmd = curr.mode;
-    pkt.motor1 = (int8_t)(curr.distance * 10);
+    pkt.motor1 = (int8_t)(dist_mm > LEGACY_DIST_MAX_MM ? LEGACY_DIST_MAX_MM
+                                                        : dist_mm);
     pkt.motor2 = 0;
-    pkt.ir_data = (curr.ir_left & 1) | ((curr.ir_middle & 1) << 1) |
-                  ((curr.ir_right & 1) << 2);
-
-    last_sent_state = curr;
+    pkt.ir_data = ir_bits;
   } else {
     // 状态无变化，发送纯心跳包 (Type 0xFE)
     pkt.type = 0xFE;
@@ -251,80 +528,59 @@ static void send_robot_state_or_heartbeat(void) {
   udp_net_common_send_to_addr(&pkt, sizeof(pkt), &g_server_addr);
 }
 
+/**
+ * @brief 发送一帧状态流（多个增量样本），发送结果反馈给速率控制
+ */
+static void send_telemetry_frame(uint64_t now_ms) {
+  uint8_t buf[ROBOT_PROTO_MAX_FRAME];
+  RobotProtoWriter w;
+  uint16_t seq = g_tx_seq;
+  robot_proto_begin(&w, buf, sizeof(buf), ROBOT_PROTO_FLAG_UPLINK, seq,
+                    (uint32_t)telemetry_stream_first_us());
+  if (telemetry_stream_encode(&w) <= 0) return;
+
+  int n = robot_proto_finish(&w);
+  if (n <= 0) return;
+  // 发送失败（lwIP 缓冲区耗尽）时序号不推进，客户端不会看到空洞
+  int ret = udp_net_common_send_to_addr(buf, (size_t)n, &g_server_addr);
+  if (ret > 0) g_tx_seq++;
+  telemetry_stream_on_sent(seq, ret, now_ms);
+}
+
 /**
  * @brief UDP 服务主任务
+ * @details 事件驱动：lwip_select 睡眠到下一个包到达或下一个定时器到期，
+ *          空闲时不再按固定周期轮询
  */
 static void* udp_service_task(const char* arg) {
   (void)arg;
 
-  // 打开Socket，设置接收超时为 10ms
-  g_sockfd =
-      udp_net_common_open_and_bind(UDP_SERVER_PORT, UDP_RECV_TIMEOUT_MS, true);
+  // 打开Socket，不设接收超时（由 select 等待，读取使用 MSG_DONTWAIT）
+  g_sockfd = udp_net_common_open_and_bind(UDP_SERVER_PORT, 0, true);
   if (g_sockfd < 0) {
     printf("[UDP] Socket 创建失败\r\n");
     return NULL;
   }
 
-  uint64_t t_wifi_check = 0;
-  uint64_t t_send_loop = 0;
-  uint64_t t_keepalive_decay = 0;
-
   while (1) {
-    uint64_t now = osal_get_jiffies();
-
-    // 1. WiFi 状态维护 (每2秒检查一次)
-    if (now - t_wifi_check >= osal_msecs_to_jiffies(2000)) {
-      udp_net_common_wifi_ensure_connected();
-      t_wifi_check = now;
-    }
-
-    bool wifi_ready = g_udp_net_wifi_connected && g_udp_net_wifi_has_ip;
-
-    if (wifi_ready) {
-      // 2. 延迟构建广播包 (确保有MAC)
-      if (!g_discovery_ready) {
-        build_discovery_packet();
-      }
-
-      // 3. 容错计次衰减：每秒减少一次生命值
-      if (now - t_keepalive_decay >= osal_msecs_to_jiffies(1000)) {
-        t_keepalive_decay = now;
-        if (g_is_connected && g_keepalive_count > 0) {
-          g_keepalive_count--;
-          // 生命值耗尽才真正断连
-          if (g_keepalive_count == 0) {
-            printf("[UDP] 连接超时 (5s内未收到心跳)，切回广播模式\r\n");
-            g_is_connected = false;
-            memset_s(&g_server_addr, sizeof(g_server_addr), 0,
-                     sizeof(g_server_addr));
-          }
-        }
-      }
-
-      // 4. 梯度频率发送：广播期500ms，连接期2s
-      uint32_t send_interval =
-          g_is_connected ? CONNECTED_HEART_MS : BROADCAST_INTERVAL_MS;
-      if (now - t_send_loop >= osal_msecs_to_jiffies(send_interval)) {
-        t_send_loop = now;
-
-        if (g_is_connected) {
-          // --- 状态 B: 连接成功 (低频心跳 2s) ---
-          send_robot_state_or_heartbeat();
-        } else if (g_discovery_ready) {
-          // --- 状态 A: 未连接 (高频广播 500ms) ---
-          udp_net_common_send_broadcast(
-              &g_discovery_pkt, sizeof(g_discovery_pkt), UDP_BROADCAST_PORT);
-        }
-      }
-    } else {
-      // WiFi未就绪，重置状态
-      g_is_connected = false;
-      g_discovery_ready = false;
-      g_keepalive_count = KEEPALIVE_MAX_COUNT;
+    uint64_t now = uapi_tcxo_get_ms();
+    timers_run(now);
+
+    uint32_t wait_ms = timers_next_wait(now);
+    struct timeval tv = {(long)(wait_ms / 1000), (long)(wait_ms % 1000) * 1000};
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    FD_SET(g_sockfd, &rfds);
+
+    int ret = lwip_select(g_sockfd + 1, &rfds, NULL, NULL, &tv);
+    g_loop_stats.wakeups++;
+    if (ret > 0 && FD_ISSET(g_sockfd, &rfds)) {
+      g_loop_stats.rx_wakeups++;
+      handle_udp_receive(uapi_tcxo_get_ms());
+    } else if (ret < 0) {
+      g_loop_stats.select_errors++;
+      osal_msleep(UDP_SELECT_RETRY_MS);
     }
-
-    // 5. 接收处理 (此处会阻塞10ms)
-    handle_udp_receive();
   }
   return NULL;
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 #define UDP_SERVICE_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "../robot_common.h"
@@ -19,12 +20,38 @@
 #define UDP_CMD_WIFI_CONFIG_CONNECT 0xE1  // 连接到指定WiFi并切换到STA模式
 #define UDP_CMD_WIFI_CONFIG_GET 0xE2      // 获取当前WiFi配置
 
+/**
+ * @brief UDP 事件循环统计（用于评估空闲唤醒次数和功耗）
+ */
+typedef struct {
+  uint32_t wakeups;        // select 返回次数（含超时）
+  uint32_t rx_wakeups;     // 因收到数据而唤醒的次数
+  uint32_t rx_packets;     // 收到的包数
+  uint32_t timer_runs;     // 定时器处理函数执行次数
+  uint32_t select_errors;  // select 出错次数
+} UdpLoopStats;
+
 void udp_service_init(void);
 bool udp_service_is_connected(void);
 WifiConnectStatus udp_service_get_wifi_status(void);
 const char* udp_service_get_ip(void);
 void udp_service_send_state(void);
-bool udp_service_pop_cmd(int8_t* motor1_out, int8_t* motor2_out);
-void udp_service_push_cmd(int8_t motor1, int8_t motor2);
+
+/**
+ * @brief 读取事件循环统计（两次读取之差除以间隔即每秒唤醒次数）
+ */
+void udp_service_get_loop_stats(UdpLoopStats* out);
+
+/**
+ * @brief 打印事件循环统计：按与上次打印之差计算每秒唤醒次数，
+ *        连同当前连接阶段和状态流统计一起输出
+ */
+void udp_service_dump_stats(void);
+
+/**
+ * @brief 向当前已连接的上位机发送数据（任意线程可调用）
+ * @return 发送字节数，未连接时返回 -1
+ */
+int udp_service_send_to_peer(const void* buf, size_t len);
 
 #endif
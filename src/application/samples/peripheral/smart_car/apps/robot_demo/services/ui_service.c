@@ -1,7 +1,31 @@
 #include "ui_service.h"
 
+#include "../core/line_estimator.h"
+#include "../core/robot_mgr.h"
+#include "soc_osal.h"
+#include "tcxo.h"
+
+/*
+ * 所有绘制和 I2C 传输只在 UI 任务中进行：
+ * - 生产者只把请求拷入一个待处理槽位（关中断保护，几十字节），
+ *   UI 任务来不及处理的旧请求直接被覆盖
+ * - UI 任务独占 SSD1306 绘制缓冲（后台缓冲），驱动内的面板镜像即前台缓冲，
+ *   刷新时只发送两者的差异
+ */
 static bool g_oled_ready = false; /* OLED 是否已初始化并可用 */
 
+static osal_semaphore g_render_sem;   /* 有新请求时释放 */
+static UiRenderRequest g_pending;     /* 待处理请求（生产者写，UI 任务取） */
+static bool g_pending_valid = false;  /* 待处理槽位是否有请求 */
+static UiRenderRequest g_shown;       /* 当前屏幕内容对应的请求（UI 任务私有） */
+static bool g_shown_valid = false;    /* g_shown 是否有效 */
+static UiStats g_stats = {0};
+
+/* 仪表盘误差曲线历史（环形，UI 任务私有），存放相对中线的像素偏移 */
+static int8_t g_err_hist[UI_DASH_HIST_LEN];
+static uint8_t g_err_head = 0;
+static uint8_t g_err_count = 0;
+
 /**
  * @brief 模式显示信息结构体
  */
@@ -9,6 +33,7 @@ typedef struct {
   const char* line0;  // 第 0 行显示文本（顶部）
   const char* line1;  // 第 1 行显示文本（中部）
   const char* line2;  // 第 2 行显示文本（底部）
+  const char* dash;   // 仪表盘标题（ASCII），NULL 表示该模式不显示仪表盘
 } ModeDisplayInfo;
 
 /*
@@ -22,20 +47,243 @@ typedef struct {
  */
 static const ModeDisplayInfo g_mode_display[] = {
     // CAR_STOP_STATUS (0)
-    {"模式: 停止", "等待...", ""},
+    {"模式: 停止", "等待...", "", NULL},
     // CAR_TRACE_STATUS (1)
-    {"模式: 循迹", "循迹中...", ""},
+    {"模式: 循迹", "循迹中...", "", "TRACE"},
     // CAR_OBSTACLE_AVOIDANCE_STATUS (2)
-    {"模式: 避障", "避障中...", ""},
+    {"模式: 避障", "避障中...", "", "AVOID"},
     // CAR_WIFI_CONTROL_STATUS (3)
-    {"模式: 遥控", "遥控中...", ""},
+    {"模式: 遥控", "遥控中...", "", "REMOTE"},
     // CAR_BT_CONTROL_STATUS (4)
-    {"模式: 蓝牙", "未启用", ""},
+    {"模式: 蓝牙", "未启用", "", NULL},
+    // CAR_CALIBRATE_STATUS (5)
+    {"模式: IR CAL", "循迹配置中...", "", NULL},
+    // CAR_AUTOTUNE_STATUS (6)
+    {"模式: PID AT", "循迹配置中...", "", NULL},
+    // CAR_SCAN_AVOID_STATUS (7)
+    {"模式: SCAN", "避障中...", "", "SCAN"},
 };
 
+/**
+ * @brief 绘制模式页（仅 UI 任务调用）
+ */
+static void ui_draw_mode_page(CarStatus status) {
+  // 直接使用枚举值作为索引（更简单，不需要循环查找）
+  int mode_count = (int)(sizeof(g_mode_display) / sizeof(g_mode_display[0]));
+  if (status >= 0 && status < mode_count) {
+    ssd1306_Fill(Black);
+    ssd1306_DrawString16(0, 0, g_mode_display[status].line0, White);
+    ssd1306_DrawString16(0, 16, g_mode_display[status].line1, White);
+    ssd1306_DrawString16(0, 32, g_mode_display[status].line2, White);
+  }
+}
+
+/**
+ * @brief 绘制待机页（仅 UI 任务调用）
+ * @param wifi_state WiFi 连接状态
+ * @param ip_addr IP 地址字符串
+ */
+static void ui_draw_standby(WifiConnectStatus wifi_state, const char* ip_addr) {
+  // WiFi 状态字符串查找表（按 WifiConnectStatus 枚举值索引）
+  static const char* wifi_state_str[] = {
+      "WiFi: 未连接",    // WIFI_STATUS_DISCONNECTED (0)
+      "WiFi: 连接中",    // WIFI_STATUS_CONNECTING (1)
+      "WiFi: 连接成功",  // WIFI_STATUS_CONNECTED (2)
+      "热点模式"         // WIFI_STATUS_AP_MODE (3)
+  };
+
+  const char* state_str = (wifi_state >= 0 && wifi_state < 4)
+                              ? wifi_state_str[wifi_state]
+                              : "WiFi: 未知状态";
+
+  ssd1306_Fill(Black);
+  ssd1306_DrawString16(0, 0, "模式: 停止", White);
+  ssd1306_DrawString16(0, 16, state_str, White);
+
+  // IP string is ASCII, but DrawString16 handles ASCII too
+  ssd1306_DrawString16(0, 32, ip_addr, White);
+}
+
+/**
+ * @brief 按满量程把数值换算为 0 ~ max_px 像素
+ */
+static uint8_t ui_scale(int32_t value, int32_t full, uint8_t max_px) {
+  if (value <= 0) return 0;
+  if (value >= full) return max_px;
+  return (uint8_t)(value * max_px / full);
+}
+
+/**
+ * @brief 以 center 为零点画有符号横条（占空比 -100 ~ 100）
+ */
+static void ui_draw_duty_bar(uint8_t y, int8_t duty) {
+  uint8_t len = ui_scale(duty < 0 ? -duty : duty, 100, UI_DASH_DUTY_HALF_W);
+  if (duty >= 0)
+    ssd1306_FillRect(UI_DASH_DUTY_CENTER, y, len, UI_DASH_DUTY_H, White);
+  else
+    ssd1306_FillRect(UI_DASH_DUTY_CENTER - len, y, len, UI_DASH_DUTY_H, White);
+}
+
+/**
+ * @brief 记录一个误差样本（换算为相对中线的像素偏移，正值向上）
+ */
+static void ui_push_error(float error) {
+  const int32_t half = UI_DASH_PLOT_H / 2 - 1;
+  int32_t px = (int32_t)(error * half / LINE_EST_POS_SCALE);
+  if (px > half) px = half;
+  if (px < -half) px = -half;
+
+  g_err_hist[g_err_head] = (int8_t)px;
+  g_err_head = (uint8_t)((g_err_head + 1) % UI_DASH_HIST_LEN);
+  if (g_err_count < UI_DASH_HIST_LEN) g_err_count++;
+}
+
+/**
+ * @brief 绘制实时仪表盘（仅 UI 任务调用）
+ * @note 布局：
+ *   第 0 页  模式 / 距离 / 误差文本
+ *   第 1 页  左右轮占空比（以中线为零点的横条）
+ *   左下     三路红外 ADC 竖条 + 距离竖条，底部标签
+ *   右下     误差历史曲线（每列一个样本，从中线填充到样本值）
+ */
+static void ui_draw_dashboard(const RobotState* st) {
+  char line[24];
+  const char* name = g_mode_display[st->mode].dash;
+  int err_x100 = (int)(st->pid_error * 100.0f);
+  int dist = (int)st->distance;
+
+  ssd1306_Fill(Black);
+
+  // 第 0 页：文本
+  char sign = (err_x100 < 0) ? '-' : '+';
+  if (err_x100 < 0) err_x100 = -err_x100;
+  (void)snprintf(line, sizeof(line), "%-6s%3dcm e%c%d.%02d", name, dist, sign,
+                 err_x100 / 100, err_x100 % 100);
+  ssd1306_SetCursor(0, 0);
+  ssd1306_DrawString(line, Font_6x8, White);
+
+  // 第 1 页：占空比
+  ssd1306_DrawVLine(UI_DASH_DUTY_CENTER, 8, 8, White);
+  ui_draw_duty_bar(9, st->duty_left);
+  ui_draw_duty_bar(9 + UI_DASH_DUTY_H + 1, st->duty_right);
+
+  // 左下：红外 ADC 与距离竖条（自底向上增长）
+  const uint16_t adc[3] = {st->adc_left, st->adc_middle, st->adc_right};
+  for (int i = 0; i < 3; i++) {
+    uint8_t h = ui_scale(adc[i], UI_DASH_ADC_FULL_MV, UI_DASH_BAR_H);
+    ssd1306_FillRect(i * UI_DASH_BAR_PITCH, UI_DASH_BAR_BOTTOM - h,
+                     UI_DASH_BAR_W, h, White);
+  }
+  uint8_t dh = ui_scale(dist, UI_DASH_DIST_FULL_CM, UI_DASH_BAR_H);
+  ssd1306_FillRect(3 * UI_DASH_BAR_PITCH, UI_DASH_BAR_BOTTOM - dh,
+                   UI_DASH_BAR_W, dh, White);
+  ssd1306_SetCursor(2, UI_DASH_BAR_BOTTOM + 1);
+  ssd1306_DrawString("L M R D", Font_6x8, White);
+
+  // 右下：误差曲线
+  const uint8_t mid = UI_DASH_PLOT_Y + UI_DASH_PLOT_H / 2;
+  ssd1306_DrawRectangle(UI_DASH_PLOT_X - 1, UI_DASH_PLOT_Y - 1,
+                        UI_DASH_PLOT_X + UI_DASH_HIST_LEN,
+                        UI_DASH_PLOT_Y + UI_DASH_PLOT_H, White);
+  ui_push_error(st->pid_error);
+  uint8_t x = UI_DASH_PLOT_X + UI_DASH_HIST_LEN - g_err_count;
+  uint8_t idx = (uint8_t)((g_err_head + UI_DASH_HIST_LEN - g_err_count) %
+                          UI_DASH_HIST_LEN);
+  for (uint8_t n = 0; n < g_err_count; n++, x++) {
+    int8_t v = g_err_hist[idx];
+    if (v >= 0)
+      ssd1306_DrawVLine(x, mid - v, v + 1, White);
+    else
+      ssd1306_DrawVLine(x, mid, -v + 1, White);
+    idx = (uint8_t)((idx + 1) % UI_DASH_HIST_LEN);
+  }
+}
+
+/**
+ * @brief 当前页面是否带仪表盘（运行类模式）
+ */
+static bool ui_page_has_dashboard(const UiRenderRequest* req) {
+  int mode_count = (int)(sizeof(g_mode_display) / sizeof(g_mode_display[0]));
+  return req->page == UI_PAGE_MODE && req->mode < mode_count &&
+         g_mode_display[req->mode].dash != NULL;
+}
+
+/**
+ * @brief 取出待处理请求
+ * @return true 取到请求，false 槽位为空
+ */
+static bool ui_take_request(UiRenderRequest* out) {
+  unsigned int irq = osal_irq_lock();
+  bool valid = g_pending_valid;
+  if (valid) {
+    *out = g_pending;
+    g_pending_valid = false;
+  }
+  osal_irq_restore(irq);
+  return valid;
+}
+
+/**
+ * @brief 刷新屏幕并记录帧时刻
+ */
+static void ui_flush(uint64_t* last_frame_ms) {
+  ssd1306_UpdateScreen();
+  g_stats.frames++;
+  *last_frame_ms = uapi_tcxo_get_ms();
+}
+
+/**
+ * @brief UI 任务：等待请求，按最大帧率取最新请求绘制并刷新
+ * @note 运行类模式的模式页显示 UI_DASH_HOLD_MS 后切换为仪表盘，
+ *       由本任务按 UI_DASH_HZ 读取状态快照自行刷新，生产者无需投递
+ */
+static void* ui_service_task(const char* arg) {
+  (void)arg;
+  const uint64_t frame_ms = 1000 / UI_MAX_FPS;
+  uint64_t last_frame_ms = 0;
+  uint64_t shown_ms = 0;  // 当前页面开始显示的时刻
+  UiRenderRequest req;
+  RobotState st;
+
+  while (1) {
+    bool dash = g_shown_valid && ui_page_has_dashboard(&g_shown);
+    if (dash)
+      (void)osal_sem_down_timeout(&g_render_sem, 1000 / UI_DASH_HZ);
+    else
+      (void)osal_sem_down(&g_render_sem);
+
+    // 限帧：距上一帧不足一个帧间隔时先休眠，期间到达的请求会覆盖槽位
+    uint64_t elapsed = uapi_tcxo_get_ms() - last_frame_ms;
+    if (elapsed < frame_ms) osal_msleep((unsigned int)(frame_ms - elapsed));
+
+    if (ui_take_request(&req) &&
+        !(g_shown_valid && memcmp(&req, &g_shown, sizeof(req)) == 0)) {
+      if (req.page == UI_PAGE_STANDBY)
+        ui_draw_standby((WifiConnectStatus)req.wifi, req.text);
+      else
+        ui_draw_mode_page((CarStatus)req.mode);
+      ui_flush(&last_frame_ms);
+
+      g_shown = req;
+      g_shown_valid = true;
+      g_err_count = 0;  // 新页面，仪表盘曲线重新开始
+      shown_ms = last_frame_ms;
+      continue;
+    }
+
+    if (dash && uapi_tcxo_get_ms() - shown_ms >= UI_DASH_HOLD_MS) {
+      robot_mgr_get_state_copy(&st);
+      if (st.mode != g_shown.mode) continue;  // 快照尚未反映模式切换
+      ui_draw_dashboard(&st);
+      ui_flush(&last_frame_ms);
+    }
+  }
+  return NULL;
+}
+
 /**
  * @brief 初始化 UI 服务（OLED 显示屏）
- * @note 初始化 I2C 总线和 SSD1306 显示屏
+ * @note 初始化 I2C 总线和 SSD1306 显示屏，成功后创建 UI 任务
  */
 void ui_service_init(void) {
   static bool init_attempted = false;  // 是否已经尝试过初始化
@@ -60,58 +308,67 @@ void ui_service_init(void) {
     printf("[OLED] 屏幕初始化失败，跳过显示屏功能\r\n");
     return;
   }
+
+  if (osal_sem_binary_sem_init(&g_render_sem, 0) != OSAL_SUCCESS) {
+    printf("[OLED] 信号量初始化失败，跳过显示屏功能\r\n");
+    return;
+  }
+  osal_task* task = osal_kthread_create((osal_kthread_handler)ui_service_task,
+                                        NULL, "ui_task", UI_TASK_STACK_SIZE);
+  if (task == NULL) {
+    osal_sem_destroy(&g_render_sem);
+    printf("[OLED] UI 任务创建失败，跳过显示屏功能\r\n");
+    return;
+  }
+  osal_kthread_set_priority(task, UI_TASK_PRIORITY);
+
   printf("[OLED] 显示屏初始化成功\r\n");
   g_oled_ready = true;
 }
 
+bool ui_request_render(const UiRenderRequest* req) {
+  if (!g_oled_ready || req == NULL) return false;
+
+  unsigned int irq = osal_irq_lock();
+  if (g_pending_valid) g_stats.coalesced++;
+  g_pending = *req;
+  g_pending_valid = true;
+  g_stats.requests++;
+  osal_irq_restore(irq);
+
+  osal_sem_up(&g_render_sem);
+  return true;
+}
+
 /**
- * @brief 在 OLED 上显示当前模式页面
+ * @brief 请求在 OLED 上显示模式页面
  * @param status 小车当前状态
  */
 void ui_show_mode_page(CarStatus status) {
-  ui_service_init();
-  if (!g_oled_ready) return;
-
-  // 直接使用枚举值作为索引（更简单，不需要循环查找）
-  int mode_count = (int)(sizeof(g_mode_display) / sizeof(g_mode_display[0]));
-  if (status >= 0 && status < mode_count) {
-    ssd1306_Fill(Black);
-    ssd1306_DrawString16(0, 0, g_mode_display[status].line0, White);
-    ssd1306_DrawString16(0, 16, g_mode_display[status].line1, White);
-    ssd1306_DrawString16(0, 32, g_mode_display[status].line2, White);
-    ssd1306_UpdateScreen();
-  }
+  UiRenderRequest req = {0};  // 整体清零，便于 UI 任务按字节比较去重
+  req.page = UI_PAGE_MODE;
+  req.mode = (uint8_t)status;
+  (void)ui_request_render(&req);
 }
 
 /**
- * @brief 在 OLED 上渲染待机页面
+ * @brief 请求在 OLED 上显示待机页面
  * @param wifi_state WiFi 连接状态描述
  * @param ip_addr IP 地址字符串
  */
 void ui_render_standby(WifiConnectStatus wifi_state, const char* ip_addr) {
-  ui_service_init();
-
-  if (!g_oled_ready) return;
-
-  // WiFi 状态字符串查找表（按 WifiConnectStatus 枚举值索引）
-  static const char* wifi_state_str[] = {
-      "WiFi: 未连接",    // WIFI_STATUS_DISCONNECTED (0)
-      "WiFi: 连接中",    // WIFI_STATUS_CONNECTING (1)
-      "WiFi: 连接成功",  // WIFI_STATUS_CONNECTED (2)
-      "热点模式"         // WIFI_STATUS_AP_MODE (3)
-  };
-
-  const char* state_str = (wifi_state >= 0 && wifi_state < 4)
-                              ? wifi_state_str[wifi_state]
-                              : "WiFi: 未知状态";
-
-  ssd1306_Fill(Black);
-  ssd1306_DrawString16(0, 0, "模式: 停止", White);
-  ssd1306_DrawString16(0, 16, state_str, White);
-
-  // IP string is ASCII, but DrawString16 handles ASCII too
-  ssd1306_DrawString16(0, 32, ip_addr, White);
-  ssd1306_UpdateScreen();
+  UiRenderRequest req = {0};
+  req.page = UI_PAGE_STANDBY;
+  req.wifi = (uint8_t)wifi_state;
+  (void)snprintf(req.text, sizeof(req.text), "%s", ip_addr ? ip_addr : "");
+  (void)ui_request_render(&req);
 }
 
 bool ui_service_is_ready(void) { return g_oled_ready; }
+
+void ui_service_get_stats(UiStats* out) {
+  if (out == NULL) return;
+  unsigned int irq = osal_irq_lock();
+  *out = g_stats;
+  osal_irq_restore(irq);
+}
@@ -21,9 +21,73 @@
   16  // I2C 数据线引脚（GPIO_16，连接 OLED 的 SDA 引脚）
 #define ROBOT_I2C_PIN_MODE 2  // GPIO 复用号
 
+/* UI 任务配置 */
+#define UI_TASK_STACK_SIZE 2048  // UI 任务栈大小
+#define UI_TASK_PRIORITY 29      // UI 任务优先级（低于控制、网络和采集任务）
+#define UI_MAX_FPS 20            // 最大刷新帧率，期间到达的请求合并为最新一个
+#define UI_TEXT_LEN 32           // 页面文本行缓冲区
+
+/* 仪表盘（运行类模式下，模式页显示 UI_DASH_HOLD_MS 后切换） */
+#define UI_DASH_HOLD_MS 1500      // 模式页停留时间
+#define UI_DASH_HZ 15             // 仪表盘刷新频率
+#define UI_DASH_ADC_FULL_MV 3300  // 红外竖条满量程 (mV)
+#define UI_DASH_DIST_FULL_CM 200  // 距离竖条满量程 (cm)
+#define UI_DASH_DUTY_CENTER 64    // 占空比横条零点 x
+#define UI_DASH_DUTY_HALF_W 63    // 占空比 100% 对应的横条长度
+#define UI_DASH_DUTY_H 3          // 占空比横条高度
+#define UI_DASH_BAR_W 10          // 竖条宽度
+#define UI_DASH_BAR_PITCH 12      // 竖条间距
+#define UI_DASH_BAR_H 38          // 竖条最大高度
+#define UI_DASH_BAR_BOTTOM 55     // 竖条底边 y（其下为标签行）
+#define UI_DASH_PLOT_X 50         // 误差曲线区域左上角 x
+#define UI_DASH_PLOT_Y 18         // 误差曲线区域左上角 y
+#define UI_DASH_PLOT_H 44         // 误差曲线区域高度
+#define UI_DASH_HIST_LEN 76       // 误差历史长度（曲线宽度，每列一个样本）
+
+/**
+ * @brief 页面类型
+ */
+typedef enum {
+  UI_PAGE_MODE = 0,  // 模式页：mode
+  UI_PAGE_STANDBY    // 待机页：wifi + text
+} UiPage;
+
+/**
+ * @brief 渲染请求（按值拷贝，只保留最新的一个）
+ */
+typedef struct {
+  uint8_t page;            // UiPage
+  uint8_t mode;            // CarStatus（UI_PAGE_MODE）
+  uint8_t wifi;            // WifiConnectStatus（UI_PAGE_STANDBY）
+  char text[UI_TEXT_LEN];  // 附加文本行，如 IP 地址（UI_PAGE_STANDBY）
+} UiRenderRequest;
+
+/**
+ * @brief UI 统计
+ */
+typedef struct {
+  uint32_t requests;   // 收到的渲染请求数
+  uint32_t coalesced;  // 未渲染即被新请求覆盖的请求数
+  uint32_t frames;     // 实际绘制并刷新的帧数
+} UiStats;
+
+/**
+ * @brief 初始化 OLED 并启动 UI 任务（OLED 不存在时 UI 功能整体关闭）
+ */
 void ui_service_init(void);
+
+/**
+ * @brief 投递渲染请求（任意线程可调用，不阻塞，不访问 I2C）
+ * @return true 已投递，false OLED 不可用
+ * @note 请求写入单个待处理槽位，UI 任务按 UI_MAX_FPS 取最新一个绘制
+ */
+bool ui_request_render(const UiRenderRequest* req);
+
+// 便捷投递接口
 void ui_show_mode_page(CarStatus status);
 void ui_render_standby(WifiConnectStatus wifi_state, const char* ip_addr);
+
 bool ui_service_is_ready(void);  // 查询 OLED 是否就绪
+void ui_service_get_stats(UiStats* out);
 
 #endif
@@ -0,0 +1,112 @@
+/**
+ * @file voice_frame.c
+ * @brief 语音模块串口帧解析实现
+ */
+
+#include "voice_frame.h"
+
+#include <stddef.h>
+
+#define VOICE_FRAME_POS_LEN 1  // 长度字节位置
+#define VOICE_FRAME_POS_CMD 2  // 命令字节位置
+
+uint8_t voice_frame_crc8(const uint8_t* data, uint16_t len) {
+  uint8_t crc = 0x00;
+  for (uint16_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++)
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+void voice_frame_parser_init(VoiceFrameParser* parser,
+                             voice_frame_handler_t handler, void* ctx) {
+  if (parser == NULL) return;
+  parser->pos = 0;
+  parser->handler = handler;
+  parser->ctx = ctx;
+  parser->stats.frames = 0;
+  parser->stats.crc_errors = 0;
+  parser->stats.len_errors = 0;
+  parser->stats.skipped = 0;
+}
+
+static void parser_feed_byte(VoiceFrameParser* p, uint8_t byte);
+
+/**
+ * @brief 丢弃当前同步字节，把其后已缓存的字节重新送入解析器
+ * @note 递归深度不超过一帧长度
+ */
+static void parser_resync(VoiceFrameParser* p) {
+  uint8_t pending[VOICE_FRAME_MAX_SIZE];
+  uint8_t n = (uint8_t)(p->pos - 1);
+  for (uint8_t i = 0; i < n; i++) pending[i] = p->buf[i + 1];
+
+  p->pos = 0;
+  p->stats.skipped++;
+  for (uint8_t i = 0; i < n; i++) parser_feed_byte(p, pending[i]);
+}
+
+static void parser_feed_byte(VoiceFrameParser* p, uint8_t byte) {
+  if (p->pos == 0) {
+    if (byte == VOICE_FRAME_SYNC)
+      p->buf[p->pos++] = byte;
+    else
+      p->stats.skipped++;
+    return;
+  }
+
+  p->buf[p->pos++] = byte;
+  uint8_t body = p->buf[VOICE_FRAME_POS_LEN];
+
+  if (p->pos == VOICE_FRAME_POS_LEN + 1) {
+    if (body == 0 || body > VOICE_FRAME_MAX_PAYLOAD + 1) {
+      p->stats.len_errors++;
+      parser_resync(p);
+    }
+    return;
+  }
+
+  // 同步 + 长度 + 命令/负载 + CRC
+  if (p->pos < body + 3) return;
+
+  if (voice_frame_crc8(&p->buf[VOICE_FRAME_POS_LEN], (uint16_t)(body + 1)) !=
+      byte) {
+    p->stats.crc_errors++;
+    parser_resync(p);
+    return;
+  }
+
+  VoiceFrame frame;
+  frame.cmd = p->buf[VOICE_FRAME_POS_CMD];
+  frame.len = (uint8_t)(body - 1);
+  for (uint8_t i = 0; i < frame.len; i++)
+    frame.payload[i] = p->buf[VOICE_FRAME_POS_CMD + 1 + i];
+  p->pos = 0;
+  p->stats.frames++;
+  if (p->handler != NULL) p->handler(&frame, p->ctx);
+}
+
+void voice_frame_feed(VoiceFrameParser* parser, const uint8_t* data,
+                      uint16_t len) {
+  if (parser == NULL || data == NULL) return;
+  for (uint16_t i = 0; i < len; i++) parser_feed_byte(parser, data[i]);
+}
+
+uint16_t voice_frame_encode(uint8_t cmd, const uint8_t* payload, uint8_t len,
+                            uint8_t* out, uint16_t size) {
+  if (out == NULL || len > VOICE_FRAME_MAX_PAYLOAD) return 0;
+  if (len > 0 && payload == NULL) return 0;
+  uint16_t total = (uint16_t)(len + VOICE_FRAME_OVERHEAD);
+  if (size < total) return 0;
+
+  out[0] = VOICE_FRAME_SYNC;
+  out[VOICE_FRAME_POS_LEN] = (uint8_t)(len + 1);
+  out[VOICE_FRAME_POS_CMD] = cmd;
+  for (uint8_t i = 0; i < len; i++)
+    out[VOICE_FRAME_POS_CMD + 1 + i] = payload[i];
+  out[total - 1] =
+      voice_frame_crc8(&out[VOICE_FRAME_POS_LEN], (uint16_t)(len + 2));
+  return total;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file voice_frame.h
+ * @brief 语音模块串口帧格式与流式解析
+ * @details 帧格式：同步字节 0xA5 | 长度 | 命令 | 负载 | CRC-8
+ *          - 长度 = 命令 + 负载的字节数 (1 ~ VOICE_FRAME_MAX_PAYLOAD + 1)
+ *          - CRC-8 多项式 0x07、初值 0x00，覆盖长度、命令和负载
+ *          解析器逐字节推进，长度非法或 CRC 错误时丢弃同步字节，从已缓存
+ *          数据中的下一个 0xA5 重新同步，不会因噪声或半帧误触发命令。
+ *          纯计算模块，不访问硬件。
+ */
+
+#ifndef VOICE_FRAME_H
+#define VOICE_FRAME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define VOICE_FRAME_SYNC 0xA5      // 同步字节
+#define VOICE_FRAME_MAX_PAYLOAD 8  // 负载最大字节数
+#define VOICE_FRAME_OVERHEAD 4     // 同步 + 长度 + 命令 + CRC
+#define VOICE_FRAME_MAX_SIZE (VOICE_FRAME_OVERHEAD + VOICE_FRAME_MAX_PAYLOAD)
+
+/**
+ * @brief 一帧解析结果
+ */
+typedef struct {
+  uint8_t cmd;                               // 命令
+  uint8_t len;                               // 负载长度
+  uint8_t payload[VOICE_FRAME_MAX_PAYLOAD];  // 负载
+} VoiceFrame;
+
+/**
+ * @brief 收到完整帧时的回调
+ */
+typedef void (*voice_frame_handler_t)(const VoiceFrame* frame, void* ctx);
+
+/**
+ * @brief 解析统计
+ */
+typedef struct {
+  uint32_t frames;      // 校验通过的帧数
+  uint32_t crc_errors;  // CRC 错误次数
+  uint32_t len_errors;  // 长度非法次数
+  uint32_t skipped;     // 同步前被跳过的字节数
+} VoiceFrameStats;
+
+/**
+ * @brief 解析器状态
+ */
+typedef struct {
+  uint8_t buf[VOICE_FRAME_MAX_SIZE];  // 当前帧已收到的字节
+  uint8_t pos;                        // 已收到的字节数
+  voice_frame_handler_t handler;
+  void* ctx;
+  VoiceFrameStats stats;
+} VoiceFrameParser;
+
+/**
+ * @brief 计算 CRC-8（多项式 0x07，初值 0x00）
+ */
+uint8_t voice_frame_crc8(const uint8_t* data, uint16_t len);
+
+/**
+ * @brief 初始化解析器
+ * @param parser 解析器
+ * @param handler 完整帧回调
+ * @param ctx 回调参数
+ */
+void voice_frame_parser_init(VoiceFrameParser* parser,
+                             voice_frame_handler_t handler, void* ctx);
+
+/**
+ * @brief 输入一段串口数据，每解析出一帧调用一次回调
+ */
+void voice_frame_feed(VoiceFrameParser* parser, const uint8_t* data,
+                      uint16_t len);
+
+/**
+ * @brief 组帧
+ * @param cmd 命令
+ * @param payload 负载（len 为 0 时可为 NULL）
+ * @param len 负载长度
+ * @param out 输出缓冲
+ * @param size 输出缓冲大小
+ * @return 帧长度，参数非法或缓冲不足时返回 0
+ */
+uint16_t voice_frame_encode(uint8_t cmd, const uint8_t* payload, uint8_t len,
+                            uint8_t* out, uint16_t size);
+
+#endif /* VOICE_FRAME_H */
@@ -9,94 +9,148 @@
 #include <string.h>
 
 #include "../../../drivers/uart/bsp_uart.h"
+#include "../core/cmd_bus.h"
+#include "../core/robot_event.h"
 #include "../core/robot_mgr.h"
 #include "soc_osal.h"
+#include "voice_frame.h"
 
 #define VOICE_CMD_TIMEOUT_MS 1000
 #define MOTOR_SPEED_HIGH 100
 #define MOTOR_SPEED_TURN 50
 #define TURN_DURATION_MS 400
 
-typedef struct {
-  int8_t l, r;
-  unsigned long long expire;  // 指令到期时刻
-} VoiceCtx;
+static uint8_t g_seq = 0;  // 命令总线帧序号（跳过 CMD_BUS_SEQ_NONE）
+static VoiceFrameParser g_parser;
 
-static VoiceCtx g_ctx = {0};
+// 统一设置动作：速度(l, r)，持续时间(ms)，持续时间即命令在总线上的有效期
+static void set_motion(int8_t l, int8_t r, uint16_t ms) {
+  if (++g_seq == CMD_BUS_SEQ_NONE) g_seq++;
+  (void)cmd_bus_publish(ROBOT_SRC_VOICE, g_seq, l, r, ms);
+}
+
+/**
+ * @brief 读取负载中的小端 uint16，负载不足时返回默认值
+ */
+static uint16_t payload_u16(const VoiceFrame* f, uint8_t offset,
+                            uint16_t fallback) {
+  if (f->len < offset + 2) return fallback;
+  return (uint16_t)(f->payload[offset] | (f->payload[offset + 1] << 8));
+}
+
+/**
+ * @brief 读取负载中的速度 (uint8 %)，负载不足时返回默认值，超过 100 时截断
+ * @note 方向由命令决定，速度字节按无符号解析，128~255 不会变成反向
+ */
+static int8_t payload_speed(const VoiceFrame* f, uint8_t offset,
+                            int8_t fallback) {
+  if (f->len < offset + 1) return fallback;
+  uint8_t v = f->payload[offset];
+  return (int8_t)(v > 100 ? 100 : v);
+}
+
+/**
+ * @brief 读取负载中的带符号轮速 (int8 %)，负载不足时返回默认值，截断到 ±100
+ */
+static int8_t payload_wheel(const VoiceFrame* f, uint8_t offset,
+                            int8_t fallback) {
+  if (f->len < offset + 1) return fallback;
+  int v = (int8_t)f->payload[offset];
+  if (v > 100) v = 100;
+  if (v < -100) v = -100;
+  return (int8_t)v;
+}
+
+static void process_mode(const VoiceFrame* f) {
+  static const CarStatus modes[] = {CAR_STOP_STATUS, CAR_TRACE_STATUS,
+                                    CAR_OBSTACLE_AVOIDANCE_STATUS,
+                                    CAR_WIFI_CONTROL_STATUS};
+  int status = -1;
+  if (f->cmd == VOICE_CMD_MODE) {
+    if (f->len >= 1 && f->payload[0] <= CAR_SCAN_AVOID_STATUS)
+      status = f->payload[0];
+  } else if (f->cmd - VOICE_CMD_STANDBY < 4) {
+    status = modes[f->cmd - VOICE_CMD_STANDBY];
+  }
+  if (status < 0) return;
 
-// 统一设置动作：速度(l, r)，持续时间(ms)
-static void set_motion(int8_t l, int8_t r, uint32_t ms) {
-  g_ctx.l = l;
-  g_ctx.r = r;
-  g_ctx.expire = osal_get_jiffies() + osal_msecs_to_jiffies(ms);
+  set_motion(0, 0, 0);
+  (void)robot_event_post_mode(ROBOT_SRC_VOICE, status);
 }
 
-static void process_command(uint8_t cmd) {
+static void process_command(const VoiceFrame* f, void* ctx) {
+  (void)ctx;
+
   // 1. 模式切换 (0x10-0x1F)
-  if (cmd >= 0x10) {
-    static const CarStatus modes[] = {CAR_STOP_STATUS, CAR_TRACE_STATUS,
-                                      CAR_OBSTACLE_AVOIDANCE_STATUS,
-                                      CAR_WIFI_CONTROL_STATUS};
-    if (cmd - 0x10 < 4) {
-      set_motion(0, 0, 0);
-      robot_mgr_set_status(modes[cmd - 0x10]);
-    }
+  if (f->cmd >= VOICE_CMD_STANDBY) {
+    process_mode(f);
     return;
   }
+  if (f->cmd > VOICE_CMD_DRIVE) return;  // 未定义的运动命令
 
   // 2. 运动控制：强制切入遥控模式
-  if (robot_mgr_get_status() != CAR_WIFI_CONTROL_STATUS)
-    robot_mgr_set_status(CAR_WIFI_CONTROL_STATUS);
+  (void)robot_event_post_mode(ROBOT_SRC_VOICE, CAR_WIFI_CONTROL_STATUS);
+
+  int8_t speed = payload_speed(
+      f, 0, f->cmd >= VOICE_CMD_LEFT ? MOTOR_SPEED_TURN : MOTOR_SPEED_HIGH);
+  uint16_t ms = payload_u16(
+      f, 1, f->cmd >= VOICE_CMD_LEFT ? TURN_DURATION_MS : VOICE_CMD_TIMEOUT_MS);
 
-  switch (cmd) {
+  switch (f->cmd) {
     case VOICE_CMD_STOP:
       set_motion(0, 0, 0);
       break;
     case VOICE_CMD_FORWARD:
-      set_motion(MOTOR_SPEED_HIGH, MOTOR_SPEED_HIGH, VOICE_CMD_TIMEOUT_MS);
+      set_motion(speed, speed, ms);
       break;
     case VOICE_CMD_BACKWARD:
-      set_motion(-MOTOR_SPEED_HIGH, -MOTOR_SPEED_HIGH, VOICE_CMD_TIMEOUT_MS);
+      set_motion(-speed, -speed, ms);
       break;
     case VOICE_CMD_LEFT:
-      set_motion(-MOTOR_SPEED_TURN, MOTOR_SPEED_TURN, TURN_DURATION_MS);
+      set_motion(-speed, speed, ms);
       break;
     case VOICE_CMD_RIGHT:
-      set_motion(MOTOR_SPEED_TURN, -MOTOR_SPEED_TURN, TURN_DURATION_MS);
+      set_motion(speed, -speed, ms);
+      break;
+    case VOICE_CMD_DRIVE:
+      if (f->len < 2) break;
+      set_motion(payload_wheel(f, 0, 0), payload_wheel(f, 1, 0),
+                 payload_u16(f, 2, VOICE_CMD_TIMEOUT_MS));
       break;
   }
 }
 
-// UART接收回调
-static void voice_rx_callback(const uint8_t* data, uint16_t length) {
-  if (!data || length == 0) return;
-  for (uint16_t i = 0; i < length; i++) {
-    process_command(data[i]);
+/**
+ * @brief 语音任务：等待串口数据，解析出完整帧后分发命令
+ */
+static void* voice_service_task(const char* arg) {
+  (void)arg;
+  uint8_t buf[64];
+
+  while (1) {
+    if (!bsp_uart_wait(VOICE_RX_WAIT_MS)) continue;
+
+    uint16_t n;
+    while ((n = bsp_uart_read(buf, sizeof(buf))) > 0)
+      voice_frame_feed(&g_parser, buf, n);
   }
+  return NULL;
 }
 
 void voice_service_init(void) {
-  memset(&g_ctx, 0, sizeof(g_ctx));
-  if (bsp_uart_init(voice_rx_callback) != 0) {
+  voice_frame_parser_init(&g_parser, process_command, NULL);
+  if (bsp_uart_init(VOICE_UART_BAUDRATE) != 0) {
     printf("[语音] 初始化失败！\r\n");
     return;
   }
-  printf("[语音] 服务已启动\r\n");
-}
 
-void voice_service_tick(void) {
-  // 只要有速度，就检查是否到期
-  if ((g_ctx.l != 0 || g_ctx.r != 0) && osal_get_jiffies() >= g_ctx.expire) {
-    g_ctx.l = 0;
-    g_ctx.r = 0;
+  osal_task* task =
+      osal_kthread_create((osal_kthread_handler)voice_service_task, NULL,
+                          "voice_rx", VOICE_TASK_STACK_SIZE);
+  if (task == NULL) {
+    printf("[语音] 任务创建失败！\r\n");
+    return;
   }
-}
-
-bool voice_service_is_cmd_active(void) {
-  return (g_ctx.l != 0 || g_ctx.r != 0);
-}
-
-void voice_service_get_motor_cmd(int8_t* l, int8_t* r) {
-  if (l) *l = g_ctx.l;
-  if (r) *r = g_ctx.r;
+  osal_kthread_set_priority(task, VOICE_TASK_PRIORITY);
+  printf("[语音] 服务已启动\r\n");
 }
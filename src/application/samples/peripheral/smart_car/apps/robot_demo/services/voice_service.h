@@ -3,11 +3,12 @@
  * @brief 语音模块命令服务 - 协议定义
  *
  * UART配置:
- *   - 波特率: 9600
+ *   - 波特率: VOICE_UART_BAUDRATE（需与语音模块配置一致，最高 115200）
  *   - 数据位: 8
  *   - 停止位: 1
  *
- * 协议格式: 单字节命令
+ * 协议格式: A5 | 长度 | 命令 | 负载 | CRC-8（见 voice_frame.h）
+ * 串口中断只把数据写入环形缓冲，帧解析和命令分发在语音任务中完成
  */
 
 #ifndef VOICE_SERVICE_H
@@ -16,29 +17,36 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#define VOICE_UART_BAUDRATE 9600    // 串口波特率
+#define VOICE_TASK_STACK_SIZE 2048  // 语音任务栈大小
+#define VOICE_TASK_PRIORITY 27      // 语音任务优先级（低于控制和 UDP 任务）
+#define VOICE_RX_WAIT_MS 1000       // 等待串口数据的超时
+
 /*
- * 协议定义 (单字节命令)
- * 0x00-0x0F: 运动控制
- * 0x10-0x1F: 模式切换
+ * 命令定义
+ * 0x00-0x0F: 运动控制，负载可选：
+ *   0x00-0x04: [速度 % (uint8)] [持续时间 ms (uint16 小端)]，缺省时使用默认值
+ *   0x05:      [左轮 % (int8)] [右轮 % (int8)] [持续时间 ms (uint16 小端)]
+ * 0x10-0x1F: 模式切换，0x1F 的负载为 [CarStatus (uint8)]
  */
 typedef enum {
   /* 运动控制 (0x00-0x0F) */
   VOICE_CMD_STOP = 0x00,      // 停止
-  VOICE_CMD_FORWARD = 0x01,   // 前进 (持续1000ms)
-  VOICE_CMD_BACKWARD = 0x02,  // 后退 (持续1000ms)
-  VOICE_CMD_LEFT = 0x03,      // 左转 (持续400ms后自动停止)
-  VOICE_CMD_RIGHT = 0x04,     // 右转 (持续400ms后自动停止)
+  VOICE_CMD_FORWARD = 0x01,   // 前进 (默认持续1000ms)
+  VOICE_CMD_BACKWARD = 0x02,  // 后退 (默认持续1000ms)
+  VOICE_CMD_LEFT = 0x03,      // 左转 (默认持续400ms后自动停止)
+  VOICE_CMD_RIGHT = 0x04,     // 右转 (默认持续400ms后自动停止)
+  VOICE_CMD_DRIVE = 0x05,     // 两轮差速，速度和持续时间由负载给出
 
   /* 模式切换 (0x10-0x1F) */
   VOICE_CMD_STANDBY = 0x10,   // 待机模式
   VOICE_CMD_TRACE = 0x11,     // 循迹模式
   VOICE_CMD_OBSTACLE = 0x12,  // 避障模式
-  VOICE_CMD_REMOTE = 0x13     // 遥控模式
+  VOICE_CMD_REMOTE = 0x13,    // 遥控模式
+  VOICE_CMD_MODE = 0x1F       // 切换到负载指定的模式
 } VoiceCommand;
 
+// 运动命令发布到命令总线（持续时间即有效期），模式命令投递为事件
 void voice_service_init(void);
-void voice_service_tick(void);
-bool voice_service_is_cmd_active(void);
-void voice_service_get_motor_cmd(int8_t* motor_l, int8_t* motor_r);
 
 #endif /* VOICE_SERVICE_H */
@@ -0,0 +1,91 @@
+/**
+ ****************************************************************************************************
+ * @file        bsp_encoder.c
+ * @brief       轮速编码器BSP层实现
+ ****************************************************************************************************
+ */
+
+#include "bsp_encoder.h"
+
+#include <stdio.h>
+
+#include "common_def.h"
+#include "gpio.h"
+#include "hal_gpio.h"
+#include "pinctrl.h"
+#include "soc_osal.h"
+#include "tcxo.h"
+
+/*
+ * 每个轮子的计数状态只由该轮的 GPIO 中断写入；
+ * rv32 上 32 位对齐读写本身是原子的，读者为了拿到 count / period /
+ * last_edge 三者一致的快照，在读取时短暂关中断
+ */
+static volatile EncoderWheel g_wheels[ENCODER_WHEEL_NUM];
+static volatile uint32_t g_glitches = 0;
+
+static const pin_t g_encoder_pins[ENCODER_WHEEL_NUM] = {ENCODER_LEFT_GPIO,
+                                                        ENCODER_RIGHT_GPIO};
+
+/**
+ * @brief 记录一个脉冲（在对应轮子的中断中调用）
+ * @param idx 轮子下标
+ */
+static void encoder_on_edge(int idx) {
+  uint64_t now = uapi_tcxo_get_us();
+  volatile EncoderWheel* w = &g_wheels[idx];
+
+  if (w->last_edge_us != 0) {
+    uint64_t dt = now - w->last_edge_us;
+    if (dt < ENCODER_MIN_PERIOD_US) {
+      g_glitches++;
+      return;
+    }
+    w->period_us = dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt;
+  }
+  w->last_edge_us = now;
+  w->count++;
+}
+
+static void encoder_left_isr(pin_t pin, uintptr_t param) {
+  unused(pin);
+  unused(param);
+  encoder_on_edge(0);
+}
+
+static void encoder_right_isr(pin_t pin, uintptr_t param) {
+  unused(pin);
+  unused(param);
+  encoder_on_edge(1);
+}
+
+int encoder_init(void) {
+  static const gpio_callback_t isr[ENCODER_WHEEL_NUM] = {encoder_left_isr,
+                                                         encoder_right_isr};
+
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++) {
+    uapi_pin_set_mode(g_encoder_pins[i], HAL_PIO_FUNC_GPIO);
+    uapi_pin_set_pull(g_encoder_pins[i], PIN_PULL_TYPE_UP);
+    uapi_gpio_set_dir(g_encoder_pins[i], GPIO_DIRECTION_INPUT);
+    if (uapi_gpio_register_isr_func(g_encoder_pins[i],
+                                    GPIO_INTERRUPT_RISING_EDGE,
+                                    isr[i]) != ERRCODE_SUCC) {
+      printf("编码器：GPIO%d 中断注册失败\r\n", g_encoder_pins[i]);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+void encoder_read(EncoderSnapshot* out) {
+  if (out == NULL) return;
+
+  unsigned int irq = osal_irq_lock();
+  for (int i = 0; i < ENCODER_WHEEL_NUM; i++) {
+    out->wheel[i].count = g_wheels[i].count;
+    out->wheel[i].period_us = g_wheels[i].period_us;
+    out->wheel[i].last_edge_us = g_wheels[i].last_edge_us;
+  }
+  out->glitches = g_glitches;
+  osal_irq_restore(irq);
+}
@@ -0,0 +1,61 @@
+/**
+ ****************************************************************************************************
+ * @file        bsp_encoder.h
+ * @brief       轮速编码器BSP层头文件
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:WS63
+ *
+ ****************************************************************************************************
+ * 单通道码盘（光电 / 霍尔），每轮一路信号接 GPIO，上升沿中断计数并测量
+ * 相邻脉冲间隔。单通道无法分辨转向，方向由上层按电机输出方向确定。
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __BSP_ENCODER_H__
+#define __BSP_ENCODER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 编码器引脚定义
+#define ENCODER_LEFT_GPIO 1    // 左轮编码器（GPIO13 为舵机接口）
+#define ENCODER_RIGHT_GPIO 14  // 右轮编码器
+
+#define ENCODER_WHEEL_NUM 2        // 轮子数量（下标 0=左 1=右）
+#define ENCODER_PULSES_PER_REV 20  // 码盘每圈脉冲数
+#define ENCODER_MIN_PERIOD_US 200  // 间隔小于该值的边沿视为抖动丢弃
+
+/**
+ * @brief 单个轮子的计数快照
+ */
+typedef struct {
+  uint32_t count;         // 累计脉冲数（32 位循环）
+  uint32_t period_us;     // 最近两个脉冲的间隔，0 表示尚不足两个脉冲
+  uint64_t last_edge_us;  // 最近一个脉冲的时刻 (TCXO us)，0 表示从未收到
+} EncoderWheel;
+
+/**
+ * @brief 两轮一致快照
+ */
+typedef struct {
+  EncoderWheel wheel[ENCODER_WHEEL_NUM];
+  uint32_t glitches;  // 被丢弃的抖动边沿总数
+} EncoderSnapshot;
+
+/**
+ * @brief 初始化编码器引脚并注册上升沿中断
+ * @return 0 成功，-1 失败
+ */
+int encoder_init(void);
+
+/**
+ * @brief 读取两轮计数快照（短暂关中断，O(1)，任意线程可调用）
+ * @param out 输出快照
+ * @return 无
+ */
+void encoder_read(EncoderSnapshot* out);
+
+#endif /* __BSP_ENCODER_H__ */
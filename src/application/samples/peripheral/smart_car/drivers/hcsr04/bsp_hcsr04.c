@@ -19,6 +19,103 @@
 
 #include "bsp_hcsr04.h"
 
+#include "common_def.h"
+
+#define HCSR04_BARRIER() __sync_synchronize()
+
+// 连续测距阶段
+typedef enum {
+  HCSR04_IDLE = 0,   // 未触发或本次已出结果
+  HCSR04_WAIT_RISE,  // 已触发，等待回波上升沿
+  HCSR04_WAIT_FALL   // 回波高电平中，等待下降沿
+} Hcsr04Phase;
+
+/*
+ * 最新值槽位（序列锁）
+ * - 写者为回波中断，或关中断状态下的定时器回调（判定超时），
+ *   两者互斥，且读者无法在写入中途抢占写者
+ * - 读者读前后序号一致即为一致结果，任何线程都不会被阻塞
+ */
+typedef struct {
+  volatile uint32_t lock_seq;  // 奇数表示正在写入
+  Hcsr04Reading reading;
+} Hcsr04Slot;
+
+static Hcsr04Slot g_slot;
+static osal_timer g_range_timer;
+static volatile Hcsr04Phase g_phase = HCSR04_IDLE;
+static volatile bool g_ranging = false;
+static uint64_t g_rise_us = 0;  // 回波上升沿时刻
+static uint32_t g_period_ms = HCSR04_MIN_PERIOD_MS;
+static volatile float g_cm_per_us;  // 单程声速 (cm/us)，即往返声速的一半
+
+/**
+ * @brief 按温度计算单程声速 (cm/us)
+ */
+static float hcsr04_cm_per_us(float celsius) {
+  // 331.3 + 0.606T (m/s) -> cm/us 为 /10000，往返再 /2
+  return (331.3f + 0.606f * celsius) / 20000.0f;
+}
+
+/**
+ * @brief 发布一次测距结果（调用方保证与其他写者互斥）
+ * @param pulse_us 回波高电平宽度，0 表示超时
+ * @param now_us 结果产生时刻
+ */
+static void hcsr04_publish(uint32_t pulse_us, uint64_t now_us) {
+  float distance = (float)pulse_us * g_cm_per_us;
+  bool valid = distance >= HCSR04_MIN_DISTANCE_CM &&
+               distance <= HCSR04_MAX_DISTANCE_CM;
+
+  g_slot.lock_seq++;
+  HCSR04_BARRIER();
+  g_slot.reading.distance_cm = valid ? distance : 0.0f;
+  g_slot.reading.timestamp_us = now_us;
+  g_slot.reading.seq++;
+  g_slot.reading.pulse_us = pulse_us;
+  g_slot.reading.valid = valid;
+  HCSR04_BARRIER();
+  g_slot.lock_seq++;
+}
+
+/**
+ * @brief 回波引脚双边沿中断：上升沿记时，下降沿计算距离
+ */
+static void hcsr04_echo_isr(pin_t pin, uintptr_t param) {
+  unused(pin);
+  unused(param);
+  uint64_t now = uapi_tcxo_get_us();
+
+  if (uapi_gpio_get_val(HCSR04_ECHO_GPIO) == GPIO_LEVEL_HIGH) {
+    if (g_phase == HCSR04_WAIT_RISE) {
+      g_rise_us = now;
+      g_phase = HCSR04_WAIT_FALL;
+    }
+  } else if (g_phase == HCSR04_WAIT_FALL) {
+    hcsr04_publish((uint32_t)(now - g_rise_us), now);
+    g_phase = HCSR04_IDLE;
+  }
+}
+
+/**
+ * @brief 测距定时器回调：判定上一次是否超时，然后发出新的触发脉冲
+ */
+static void hcsr04_range_timer_cb(unsigned long data) {
+  unused(data);
+  if (!g_ranging) return;
+
+  unsigned int irq = osal_irq_lock();
+  if (g_phase != HCSR04_IDLE) hcsr04_publish(0, uapi_tcxo_get_us());
+  g_phase = HCSR04_WAIT_RISE;
+  osal_irq_restore(irq);
+
+  uapi_gpio_set_val(HCSR04_TRIG_GPIO, GPIO_LEVEL_HIGH);
+  uapi_tcxo_delay_us(HCSR04_TRIG_PULSE_US);
+  uapi_gpio_set_val(HCSR04_TRIG_GPIO, GPIO_LEVEL_LOW);
+
+  (void)osal_timer_mod(&g_range_timer, g_period_ms);  // 单次定时器，重新装载
+}
+
 /**
  * @brief 初始化HC-SR04超声波传感器
  * @return 无
@@ -34,13 +131,77 @@ void hcsr04_init(void) {
 
   // 3. 初始化回响引脚为输入
   uapi_gpio_set_dir(HCSR04_ECHO_GPIO, GPIO_DIRECTION_INPUT);
+
+  g_cm_per_us = hcsr04_cm_per_us(HCSR04_DEFAULT_TEMP_C);
+}
+
+void hcsr04_set_temperature(float celsius) {
+  g_cm_per_us = hcsr04_cm_per_us(celsius);
+}
+
+int hcsr04_start_ranging(uint32_t period_ms) {
+  if (g_ranging) return 0;
+
+  g_period_ms = period_ms < HCSR04_MIN_PERIOD_MS ? HCSR04_MIN_PERIOD_MS
+                                                 : period_ms;
+  g_phase = HCSR04_IDLE;
+
+  if (uapi_gpio_register_isr_func(HCSR04_ECHO_GPIO, GPIO_INTERRUPT_DEDGE,
+                                  hcsr04_echo_isr) != ERRCODE_SUCC) {
+    printf("HC-SR04：回波中断注册失败\r\n");
+    return -1;
+  }
+
+  if (g_range_timer.timer == NULL) {
+    g_range_timer.handler = hcsr04_range_timer_cb;
+    g_range_timer.data = 0;
+    g_range_timer.interval = g_period_ms;
+    if (osal_timer_init(&g_range_timer) != OSAL_SUCCESS) {
+      printf("HC-SR04：测距定时器创建失败\r\n");
+      (void)uapi_gpio_unregister_isr_func(HCSR04_ECHO_GPIO);
+      return -1;
+    }
+  }
+
+  g_ranging = true;
+  (void)osal_timer_mod(&g_range_timer, g_period_ms);
+  printf("HC-SR04：连续测距已启动，周期 %ums\r\n", (unsigned)g_period_ms);
+  return 0;
+}
+
+void hcsr04_stop_ranging(void) {
+  if (!g_ranging) return;
+  g_ranging = false;
+  (void)osal_timer_stop(&g_range_timer);
+  (void)uapi_gpio_unregister_isr_func(HCSR04_ECHO_GPIO);
+  g_phase = HCSR04_IDLE;
+}
+
+bool hcsr04_get_latest(Hcsr04Reading* out) {
+  if (out == NULL) return false;
+
+  while (1) {
+    uint32_t seq = g_slot.lock_seq;
+    HCSR04_BARRIER();
+    if (seq & 1u) continue;  // 写者在中断中，很快完成
+    *out = g_slot.reading;
+    HCSR04_BARRIER();
+    if (g_slot.lock_seq == seq) break;
+  }
+  return out->seq != 0;
 }
 
 /**
  * @brief 获取距离测量值
  * @return 距离值 (单位: cm), 测量失败返回0
+ * @note 连续测距运行时直接返回最新结果；否则阻塞完成一次测量
  */
 float hcsr04_get_distance(void) {
+  if (g_ranging) {
+    Hcsr04Reading reading;
+    return hcsr04_get_latest(&reading) ? reading.distance_cm : 0.0f;
+  }
+
   unsigned int start_time = 0;
   unsigned int end_time = 0;
   unsigned int pulse_width = 0;
@@ -94,8 +255,8 @@ float hcsr04_get_distance(void) {
   pulse_width = end_time - start_time;
 
   // 计算距离: 距离 = 高电平时间 * 声速 / 2
-  // 声速约为 340m/s = 0.034 cm/us
-  distance = (float)pulse_width * 0.034f / 2.0f;
+  // 声速按 hcsr04_set_temperature() 设置的温度修正（默认 20°C 约 343m/s）
+  distance = (float)pulse_width * g_cm_per_us;
 
   // 限制在有效测量范围内 (2cm ~ 500cm)
   // 超出范围的值通常表示测量异常或超出量程
@@ -20,6 +20,7 @@
 #ifndef __BSP_HCSR04_H__
 #define __BSP_HCSR04_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
@@ -37,11 +38,16 @@
 #define HCSR04_GPIO_FUNC HAL_PIO_FUNC_GPIO
 
 // 测距参数
-#define HCSR04_TIMEOUT_US 40000  // 超时时间 (us)
+#define HCSR04_TIMEOUT_US 40000   // 超时时间 (us)
+#define HCSR04_MIN_PERIOD_MS 60   // 连续测距最小周期（需大于回波超时）
+#define HCSR04_TRIG_PULSE_US 20   // 触发脉冲宽度 (us)，手册要求 >= 10us
+#define HCSR04_DEFAULT_TEMP_C 20  // 未设置温度时按 20°C 计算声速
 
 // HC-SR04 有效测量范围: 2cm ~ 500cm
 #define HCSR04_MIN_DISTANCE_CM 2.0f
 #define HCSR04_MAX_DISTANCE_CM 500.0f
+// 无效回波宽度低于该值判为过近（下限约 120us，上限约 29000us）
+#define HCSR04_NEAR_PULSE_US 1000
 
 /**
  * @brief 初始化HC-SR04超声波传感器
@@ -49,9 +55,54 @@
  */
 void hcsr04_init(void);
 
+/**
+ * @brief 一次测距结果
+ */
+typedef struct {
+  float distance_cm;      // 距离 (cm)，测量失败或超出量程时为 0
+  uint64_t timestamp_us;  // 结果产生时刻 (TCXO us)
+  uint32_t seq;           // 测量序号，每产生一次结果加 1
+  uint32_t pulse_us;      // 回波高电平宽度 (us)，0 表示超时无回波
+  bool valid;             // 是否为量程内的有效回波
+} Hcsr04Reading;
+
+/**
+ * @brief 无效结果是否因回波过近（紧贴障碍物），而非超时或远于量程
+ */
+static inline bool hcsr04_reading_too_close(const Hcsr04Reading* r) {
+  return !r->valid && r->pulse_us > 0 && r->pulse_us < HCSR04_NEAR_PULSE_US;
+}
+
+/**
+ * @brief 设置空气温度，用于修正声速 c = 331.3 + 0.606 * T (m/s)
+ * @param celsius 温度 (°C)
+ */
+void hcsr04_set_temperature(float celsius);
+
+/**
+ * @brief 启动中断驱动的连续测距
+ * @param period_ms 触发周期 (ms)，小于 HCSR04_MIN_PERIOD_MS 时按最小周期
+ * @return 0 成功，-1 失败
+ * @note 软件定时器周期性发出触发脉冲，回波上升 / 下降沿在 GPIO 中断中
+ *       打时间戳并计算距离，结果写入最新值槽位；超时在下一次触发时判定
+ */
+int hcsr04_start_ranging(uint32_t period_ms);
+
+/**
+ * @brief 停止连续测距
+ */
+void hcsr04_stop_ranging(void);
+
+/**
+ * @brief 读取最新一次测距结果（O(1)，不阻塞，任意线程可调用）
+ * @return true 已有结果，false 连续测距未启动或尚无结果
+ */
+bool hcsr04_get_latest(Hcsr04Reading* out);
+
 /**
  * @brief 获取距离测量值
  * @return 距离值 (单位: cm), 测量失败返回0
+ * @note 连续测距运行时直接返回最新结果；否则阻塞完成一次测量
  */
 float hcsr04_get_distance(void);
 
@@ -11,13 +11,33 @@
 #include "bsp_l9110s.h"
 
 #include <stdint.h>
+#include <stdio.h>
 
 #include "gpio.h"
 #include "pinctrl.h"
 #include "pwm.h"
 #include "soc_osal.h"
+#include "tcxo.h"
 
-static void pwm_update(uint8_t ch, uint32_t duty) {
+#define L9110S_PWM_GROUP 0  // 四路电机 PWM 所在分组
+#define L9110S_DUTY_UNSET UINT32_MAX
+#define L9110S_SLEW_SCALE 1000  // 斜率积分精度：内部输出以 0.001% 为单位
+
+static int8_t g_cmd_left = 0;  /* 最近一次下发的左轮速度 */
+static int8_t g_cmd_right = 0; /* 最近一次下发的右轮速度 */
+
+static uint32_t g_duty[L9110S_CHANNEL_NUM]; /* 各通道已写入的占空比 */
+static L9110sStats g_stats;                 /* 更新统计 */
+
+static L9110sShaping g_shaping;     /* 输出整形参数 */
+static int32_t g_ramp[2];           /* 斜率限制后的左 / 右输出 (0.001%) */
+static int8_t g_out[2];             /* 整形后的左 / 右实际输出 */
+static uint64_t g_last_tick_us = 0; /* 上次推进斜率的时刻 */
+
+/**
+ * @brief 以指定占空比打开单通道 PWM（仅初始化时使用）
+ */
+static void pwm_open(uint8_t ch, uint32_t duty) {
   // 配置结构体 (利用 C99 指定初始化，未指定成员自动为0)
   pwm_config_t cfg = {
       .low_time = PWM_PERIOD - duty, .high_time = duty, .repeat = true};
@@ -27,17 +47,26 @@ static void pwm_update(uint8_t ch, uint32_t duty) {
 void l9110s_init(void) {
   uapi_pwm_init();  // 初始化 PWM
 
-  for (int i = 0; i < 4; i++) {
+  for (int i = 0; i < L9110S_CHANNEL_NUM; i++) {
     uapi_pin_set_mode(MOTOR_CH[i], 1);  // 设置为模式 1 （PWM）
-    pwm_update(MOTOR_CH[i], 0);         // 初始占空比 0
+    pwm_open(MOTOR_CH[i], 0);           // 初始占空比 0
+    g_duty[i] = 0;
   }
+  l9110s_set_shaping(NULL);
 
-  uapi_pwm_set_group(0, (uint8_t*)MOTOR_CH, 4);  // 设置 PWM 分组
-  uapi_pwm_start_group(0);                       // 启动分组
+  // 设置 PWM 分组并启动
+  uapi_pwm_set_group(L9110S_PWM_GROUP, (uint8_t*)MOTOR_CH, L9110S_CHANNEL_NUM);
+  uapi_pwm_start_group(L9110S_PWM_GROUP);
 }
 
-// 辅助内联：处理单边电机逻辑
-static inline void set_side(uint8_t idx_a, uint8_t idx_b, int8_t speed) {
+/**
+ * @brief 计算单边电机 A/B 通道占空比
+ * @param speed 速度 -100~100
+ * @param duty_a 输出 A 通道占空比
+ * @param duty_b 输出 B 通道占空比
+ */
+static inline void side_duty(int8_t speed, uint32_t* duty_a,
+                             uint32_t* duty_b) {
   // 1. 限幅
   if (speed > 100) speed = 100;
   if (speed < -100) speed = -100;
@@ -48,12 +77,180 @@ static inline void set_side(uint8_t idx_a, uint8_t idx_b, int8_t speed) {
   // 2. 根据方向设置 A/B 通道 (利用三元运算符)
   // Speed > 0: A=0,    B=Duty (前进)
   // Speed < 0: A=Duty, B=0    (后退)
-  pwm_update(MOTOR_CH[idx_a], (speed < 0) ? duty : 0);
-  pwm_update(MOTOR_CH[idx_b], (speed > 0) ? duty : 0);
+  *duty_a = (speed < 0) ? duty : 0;
+  *duty_b = (speed > 0) ? duty : 0;
+}
+
+/**
+ * @brief 写入有变化的通道占空比
+ * @note 预加载模式下新配置写入影子寄存器，由分组在当前 PWM 周期结束时
+ *       统一装载，通道不会被关闭重开；四路写入在同一关中断区内完成
+ *       （数微秒，远小于 PWM 周期），因此同一次更新在同一周期生效
+ */
+static void pwm_apply(const uint32_t duty[L9110S_CHANNEL_NUM]) {
+  uint32_t irq = osal_irq_lock();
+  for (int i = 0; i < L9110S_CHANNEL_NUM; i++) {
+    if (duty[i] == g_duty[i]) continue;
+    pwm_config_t cfg = {.low_time = PWM_PERIOD - duty[i],
+                        .high_time = duty[i],
+                        .repeat = true};
+#if defined(CONFIG_PWM_PRELOAD)
+    errcode_t ret =
+        uapi_pwm_config_preload(L9110S_PWM_GROUP, MOTOR_CH[i], &cfg);
+#else
+    errcode_t ret = uapi_pwm_open(MOTOR_CH[i], &cfg);
+#endif
+    if (ret == ERRCODE_SUCC) {
+      g_duty[i] = duty[i];
+    } else {
+      g_duty[i] = L9110S_DUTY_UNSET;  // 下次强制重写
+      g_stats.errors++;
+    }
+  }
+#if !defined(CONFIG_PWM_PRELOAD)
+  uapi_pwm_start_group(L9110S_PWM_GROUP);  // 无预加载时需重新启动分组
+#endif
+  osal_irq_restore(irq);
+}
+
+/**
+ * @brief 按斜率把输出向目标推进一步
+ * @param cur 当前输出 (0.001%)
+ * @param target 目标输出 (0.001%)
+ * @param dt_us 距上次推进的时间
+ * @return 新的输出
+ * @note 反向时先按减速斜率回到 0，再按加速斜率向新方向加速
+ */
+static int32_t slew_step(int32_t cur, int32_t target, uint32_t dt_us) {
+  for (int phase = 0; phase < 2 && cur != target; phase++) {
+    bool reverse = (cur > 0 && target < 0) || (cur < 0 && target > 0);
+    int32_t goal = reverse ? 0 : target;
+    bool away = (goal > 0 && goal > cur) || (goal < 0 && goal < cur);
+    uint16_t rate = away ? g_shaping.accel_pct_s : g_shaping.decel_pct_s;
+    if (rate == 0) {
+      cur = goal;  // 该方向不限制，直接到位后处理下一段
+      continue;
+    }
+    // (%/s) * us = 0.001% * (rate * dt_us / 1000)
+    int32_t step = (int32_t)((uint32_t)rate * dt_us / 1000u);
+    int32_t diff = goal - cur;
+    if (diff > step)
+      cur += step;
+    else if (diff < -step)
+      cur -= step;
+    else
+      cur = goal;
+    break;
+  }
+  return cur;
+}
+
+/**
+ * @brief 单轮增益修正和死区补偿
+ * @param ramp 斜率限制后的输出 (0.001%)
+ * @param side 0=左 1=右
+ * @return 实际输出 -100~100
+ */
+static int8_t shape_output(int32_t ramp, int side) {
+  int32_t v = ramp * (1000 + g_shaping.trim_permille[side]) /
+              (1000 * L9110S_SLEW_SCALE);
+  if (v > 100) v = 100;
+  if (v < -100) v = -100;
+
+  if (v != 0 && g_shaping.deadband_pct > 0) {
+    int32_t mag = (v < 0) ? -v : v;
+    mag = g_shaping.deadband_pct + mag * (100 - g_shaping.deadband_pct) / 100;
+    v = (v < 0) ? -mag : mag;
+  }
+  return (int8_t)v;
+}
+
+void l9110s_tick(void) {
+  uint64_t now = uapi_tcxo_get_us();
+  uint64_t elapsed = (g_last_tick_us != 0) ? now - g_last_tick_us : 0;
+  uint32_t dt_us = elapsed > L9110S_SLEW_MAX_DT_US ? L9110S_SLEW_MAX_DT_US
+                                                   : (uint32_t)elapsed;
+  g_last_tick_us = now;
+
+  int32_t target_left = g_cmd_left > 100 ? 100 : g_cmd_left;
+  int32_t target_right = g_cmd_right > 100 ? 100 : g_cmd_right;
+  if (target_left < -100) target_left = -100;
+  if (target_right < -100) target_right = -100;
+
+  g_ramp[0] = slew_step(g_ramp[0], target_left * L9110S_SLEW_SCALE, dt_us);
+  g_ramp[1] = slew_step(g_ramp[1], target_right * L9110S_SLEW_SCALE, dt_us);
+  g_out[0] = shape_output(g_ramp[0], 0);
+  g_out[1] = shape_output(g_ramp[1], 1);
+
+  uint32_t duty[L9110S_CHANNEL_NUM];
+  side_duty(g_out[0], &duty[0], &duty[1]);  // 左轮
+  side_duty(g_out[1], &duty[2], &duty[3]);  // 右轮
+
+  bool changed = false;
+  for (int i = 0; i < L9110S_CHANNEL_NUM; i++)
+    if (duty[i] != g_duty[i]) changed = true;
+  if (!changed) {
+    g_stats.skipped++;  // 占空比未变化，不访问硬件
+    return;
+  }
+
+  uint64_t start = uapi_tcxo_get_us();
+  pwm_apply(duty);
+  uint32_t lat = (uint32_t)(uapi_tcxo_get_us() - start);
+
+  g_stats.updates++;
+  g_stats.latency_last_us = lat;
+  if (lat > g_stats.latency_max_us) g_stats.latency_max_us = lat;
 }
 
 void l9110s_set_differential(int8_t left, int8_t right) {
-  set_side(0, 1, left);     // 设置左轮
-  set_side(2, 3, right);    // 设置右轮
-  uapi_pwm_start_group(0);  // 使能
-}
\ No newline at end of file
+  g_cmd_left = left;
+  g_cmd_right = right;
+  l9110s_tick();  // 立即推进一步，响应不等到下一个控制周期
+}
+
+void l9110s_set_shaping(const L9110sShaping* shaping) {
+  if (shaping == NULL) {
+    g_shaping.accel_pct_s = L9110S_DEFAULT_ACCEL;
+    g_shaping.decel_pct_s = L9110S_DEFAULT_DECEL;
+    g_shaping.deadband_pct = 0;
+    g_shaping.trim_permille[0] = 0;
+    g_shaping.trim_permille[1] = 0;
+    return;
+  }
+
+  g_shaping = *shaping;
+  if (g_shaping.deadband_pct > L9110S_MAX_DEADBAND)
+    g_shaping.deadband_pct = L9110S_MAX_DEADBAND;
+  for (int i = 0; i < 2; i++) {
+    if (g_shaping.trim_permille[i] > L9110S_MAX_TRIM)
+      g_shaping.trim_permille[i] = L9110S_MAX_TRIM;
+    if (g_shaping.trim_permille[i] < -L9110S_MAX_TRIM)
+      g_shaping.trim_permille[i] = -L9110S_MAX_TRIM;
+  }
+}
+
+void l9110s_get_shaping(L9110sShaping* shaping) {
+  if (shaping) *shaping = g_shaping;
+}
+
+void l9110s_get_output(int8_t* left, int8_t* right) {
+  if (left) *left = g_out[0];
+  if (right) *right = g_out[1];
+}
+
+void l9110s_get_differential(int8_t* left, int8_t* right) {
+  if (left) *left = g_cmd_left;
+  if (right) *right = g_cmd_right;
+}
+
+void l9110s_get_stats(L9110sStats* out) {
+  if (out) *out = g_stats;
+}
+
+void l9110s_dump_stats(void) {
+  printf("[电机] 更新:%u 跳过:%u 失败:%u 写入耗时(us) 最近:%u 最大:%u\r\n",
+         (unsigned)g_stats.updates, (unsigned)g_stats.skipped,
+         (unsigned)g_stats.errors, (unsigned)g_stats.latency_last_us,
+         (unsigned)g_stats.latency_max_us);
+}
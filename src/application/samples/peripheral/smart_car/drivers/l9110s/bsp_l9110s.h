@@ -20,11 +20,42 @@
 #ifndef __BSP_L9110S_H__
 #define __BSP_L9110S_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 // 驱动电机GPIO口:  4, 5, 0, 2
 static const uint8_t MOTOR_CH[] = {4, 5, 0, 2};
-#define PWM_PERIOD 50  // 20kHz (50us)
+#define PWM_PERIOD 50         // 20kHz (50us)
+#define L9110S_CHANNEL_NUM 4  // 通道数（左 A/B、右 A/B）
+
+// 输出整形默认参数
+#define L9110S_DEFAULT_ACCEL 400     // 加速斜率 (%/s)，0~100% 约 250ms
+#define L9110S_DEFAULT_DECEL 1000    // 减速斜率 (%/s)，100%~0 约 100ms
+#define L9110S_MAX_DEADBAND 60       // 死区补偿上限 (%)
+#define L9110S_MAX_TRIM 300          // 单轮增益修正上限 (‰)
+#define L9110S_SLEW_MAX_DT_US 20000  // 单步斜率积分的最大时间间隔
+
+/**
+ * @brief 输出整形参数
+ * @note 处理顺序：目标速度 -> 斜率限制 -> 单轮增益修正 -> 死区补偿 -> 占空比
+ */
+typedef struct {
+  uint16_t accel_pct_s;      // 远离 0 方向的斜率 (%/s)，0 表示不限制
+  uint16_t decel_pct_s;      // 趋向 0 方向的斜率 (%/s)，0 表示不限制
+  uint8_t deadband_pct;      // 非零输出映射到 [deadband, 100]，克服静摩擦
+  int16_t trim_permille[2];  // 左 / 右轮增益修正，输出乘 (1000 + trim) / 1000
+} L9110sShaping;
+
+/**
+ * @brief 占空比更新统计
+ */
+typedef struct {
+  uint32_t updates;          // 实际写入硬件的次数
+  uint32_t skipped;          // 占空比未变化而跳过的次数
+  uint32_t errors;           // 通道写入失败次数
+  uint32_t latency_last_us;  // 最近一次写入耗时
+  uint32_t latency_max_us;   // 最大写入耗时
+} L9110sStats;
 
 /**
  * @brief 初始化L9110S电机驱动
@@ -44,7 +75,59 @@ void l9110s_init(void);
  * @param left_speed 左轮速度 -100~100
  * @param right_speed 右轮速度 -100~100
  * @return 无
+ * @note 设置的是目标速度，实际输出按斜率逐拍逼近（见 l9110s_tick）；
+ *       只写入有变化的通道，经预加载在下一个 PWM 周期边界同时生效
  */
 void l9110s_set_differential(int8_t left_speed, int8_t right_speed);
 
+/**
+ * @brief 输出整形推进一步：按距上次的时间推进斜率并写入占空比
+ * @return 无
+ * @note 每个控制周期调用一次，O(1)；未调用时输出只在设置目标时更新
+ */
+void l9110s_tick(void);
+
+/**
+ * @brief 设置输出整形参数（超出范围的值被截断）
+ * @param shaping 参数，NULL 表示恢复默认
+ * @return 无
+ */
+void l9110s_set_shaping(const L9110sShaping* shaping);
+
+/**
+ * @brief 获取当前输出整形参数
+ * @param shaping 输出参数
+ * @return 无
+ */
+void l9110s_get_shaping(L9110sShaping* shaping);
+
+/**
+ * @brief 获取整形后的实际输出（斜率、修正、死区之后）
+ * @param left_speed 输出左轮（可为 NULL）
+ * @param right_speed 输出右轮（可为 NULL）
+ * @return 无
+ */
+void l9110s_get_output(int8_t* left_speed, int8_t* right_speed);
+
+/**
+ * @brief 获取最近一次下发的双轮速度
+ * @param left_speed 输出左轮速度（可为 NULL）
+ * @param right_speed 输出右轮速度（可为 NULL）
+ * @return 无
+ */
+void l9110s_get_differential(int8_t* left_speed, int8_t* right_speed);
+
+/**
+ * @brief 获取占空比更新统计
+ * @param out 输出统计
+ * @return 无
+ */
+void l9110s_get_stats(L9110sStats* out);
+
+/**
+ * @brief 打印占空比更新统计
+ * @return 无
+ */
+void l9110s_dump_stats(void);
+
 #endif /* __BSP_L9110S_H__ */
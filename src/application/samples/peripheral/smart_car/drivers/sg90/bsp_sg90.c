@@ -0,0 +1,74 @@
+/**
+ ****************************************************************************************************
+ * @file        bsp_sg90.c
+ * @brief       SG90舵机BSP层实现
+ ****************************************************************************************************
+ */
+
+#include "bsp_sg90.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "common_def.h"
+#include "gpio.h"
+#include "hal_gpio.h"
+#include "pinctrl.h"
+#include "timer.h"
+
+static timer_handle_t g_timer = NULL;                     /* 脉冲定时器 */
+static volatile unsigned int g_angle = SG90_ANGLE_CENTER; /* 目标角度 */
+static volatile uint32_t g_pulse_us = 0;                  /* 目标高电平宽度 */
+static bool g_high = false;                               /* 当前输出电平 */
+
+/**
+ * @brief 角度换算为高电平宽度 (us)
+ */
+static uint32_t sg90_angle_to_pulse(unsigned int angle) {
+  return SG90_PULSE_0_DEG +
+         angle * (SG90_PULSE_180_DEG - SG90_PULSE_0_DEG) / SG90_ANGLE_MAX;
+}
+
+/**
+ * @brief 定时器回调：交替输出高 / 低电平并装载下一段时长
+ * @note 高电平宽度在每个周期开始时锁存，周期内修改角度不会产生畸形脉冲
+ */
+static void sg90_timer_callback(uintptr_t data) {
+  unused(data);
+  static uint32_t pulse_us = 0;
+
+  if (!g_high) {
+    pulse_us = g_pulse_us;
+    uapi_gpio_set_val(SG90_GPIO, GPIO_LEVEL_HIGH);
+    g_high = true;
+    (void)uapi_timer_start(g_timer, pulse_us, sg90_timer_callback, 0);
+  } else {
+    uapi_gpio_set_val(SG90_GPIO, GPIO_LEVEL_LOW);
+    g_high = false;
+    (void)uapi_timer_start(g_timer, SG90_PWM_PERIOD_US - pulse_us,
+                           sg90_timer_callback, 0);
+  }
+}
+
+int sg90_init(void) {
+  uapi_pin_set_mode(SG90_GPIO, HAL_PIO_FUNC_GPIO);
+  uapi_gpio_set_dir(SG90_GPIO, GPIO_DIRECTION_OUTPUT);
+  uapi_gpio_set_val(SG90_GPIO, GPIO_LEVEL_LOW);
+  g_pulse_us = sg90_angle_to_pulse(g_angle);
+
+  if (uapi_timer_create(SG90_TIMER_INDEX, &g_timer) != ERRCODE_SUCC) {
+    printf("SG90：定时器创建失败\r\n");
+    return -1;
+  }
+  g_high = false;
+  (void)uapi_timer_start(g_timer, SG90_PWM_PERIOD_US, sg90_timer_callback, 0);
+  return 0;
+}
+
+void sg90_set_angle(unsigned int angle) {
+  if (angle > SG90_ANGLE_MAX) angle = SG90_ANGLE_MAX;
+  g_angle = angle;
+  g_pulse_us = sg90_angle_to_pulse(angle);  // 32 位写入，回调读到的总是完整值
+}
+
+unsigned int sg90_get_angle(void) { return g_angle; }
@@ -0,0 +1,58 @@
+/**
+ ****************************************************************************************************
+ * @file        bsp_sg90.h
+ * @brief       SG90舵机BSP层头文件 (智能小车专用)
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:WS63
+ *
+ ****************************************************************************************************
+ * 舵机接 JP4 舵机接口 SG1。脉冲由硬件定时器中断翻转 GPIO 产生，
+ * 不占用任何任务；设置角度只修改下一个周期的高电平宽度，立即返回。
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __BSP_SG90_H__
+#define __BSP_SG90_H__
+
+#include <stdint.h>
+
+// 舵机引脚定义 (JP4 舵机接口 SG1)
+// 注意: GPIO_13 也连接了 LED2 (蓝色)，控制舵机时蓝色LED2会闪烁
+#define SG90_GPIO 13
+
+// 脉冲参数
+#define SG90_PWM_PERIOD_US 20000  // PWM周期 20ms
+#define SG90_PULSE_0_DEG 500      // 0度对应高电平 0.5ms
+#define SG90_PULSE_180_DEG 2500   // 180度对应高电平 2.5ms
+#define SG90_TIMER_INDEX 1        // 与控制调度共用 TIMER1（驱动内按软定时器复用）
+
+// 舵机角度范围
+#define SG90_ANGLE_MIN 0
+#define SG90_ANGLE_MAX 180
+#define SG90_ANGLE_CENTER 90
+
+#define SG90_US_PER_DEG 2000  // 空载转速约 0.12s/60°，用于估算转到位的时间
+
+/**
+ * @brief 初始化舵机引脚并启动脉冲输出（初始角度 SG90_ANGLE_CENTER）
+ * @return 0 成功，-1 失败
+ */
+int sg90_init(void);
+
+/**
+ * @brief 设置目标角度（下一个 PWM 周期生效，不阻塞）
+ * @param angle 角度值 (0-180)，超出时截断
+ * @return 无
+ */
+void sg90_set_angle(unsigned int angle);
+
+/**
+ * @brief 获取当前目标角度
+ * @return 角度值 (0-180)
+ */
+unsigned int sg90_get_angle(void);
+
+#endif /* __BSP_SG90_H__ */
@@ -1,1071 +1,1007 @@
-﻿/* 生成的字体点阵数据 扫描方式：列行扫描  取模走向：低位在前 */
+/* 由 tools/gen_font16.py 生成，请勿手工编辑 */
+/* 扫描方式：列行扫描  取模走向：低位在前（与 SSD1306 页格式一致）
+ * 前 16 字节为上半页 (行 0~7)，后 16 字节为下半页 (行 8~15)
+ * 码点表按升序排列，查找时使用二分查找 */
 
-/* 字符编码格式：GB2312，查找字符对应的点阵数据参考代码如下:
-int FindFontIndex(const unsigned char *target)
-{
-    int i;
-    // 遍历索引表
-    for (i = 0; i < (sizeof(g_font_dot_matrix_16_index) /
-sizeof(g_font_dot_matrix_16_index[0])); i++)
-    {
-        // 匹配汉字或ASC
-        // ASC字宽1个字节，值范围（0x00~0x7F）
-        // 汉字字宽为2个字节，第一字节（0xA1~0xF7）,第二字节（0xA1~0xFE）
-        if (strncmp(g_font_dot_matrix_16_index[i], target, (target[0] > 0x7F) ?
-2 : 1) == 0)
-        {
-            // 返回索引值
-            return i;
-        }
-    }
-    // 没有找到
-    return -1;
-}
+#include "FontDotMatrix16.h"
 
+const uint16_t g_font_dot_matrix_16_count = 162;
 
-// 字符编码格式：UTF-8，查找字符对应的点阵数据参考代码如下:
-// 获取UTF-8字符字节长度
-int GetUtf8CharLength(const unsigned char *target)
-{
-    if (target[0] <= 0x7F) {
-        // 单字节UTF-8字符 (0xxxxxxx)
-        return 1;
-    } else if ((target[0] >= 0xC2 && target[0] <= 0xDF) && (target[1] & 0xC0) ==
-0x80) {
-        // 双字节UTF-8字符 (110xxxxx 10xxxxxx)
-        return 2;
-    } else if ((target[0] >= 0xE0 && target[0] <= 0xEF) && (target[1] & 0xC0) ==
-0x80 && (target[2] & 0xC0) == 0x80) {
-        // 三字节UTF-8字符 (1110xxxx 10xxxxxx 10xxxxxx)
-        return 3;
-    } else if ((target[0] >= 0xF0 && target[0] <= 0xF7) && (target[1] & 0xC0) ==
-0x80 && (target[2] & 0xC0) == 0x80 && (target[3] & 0xC0) == 0x80) {
-        // 四字节UTF-8字符 (11110xxx 10xxxxxx 10xxxxxx 10xxxxxx)
-        return 4;
-    }
-    // 默认单字节
-    return 1;
-}
-
-int FindFontIndex(const char *target)
-{
-    int i;
-    int charLen = GetUtf8CharLength(target); // 获取字符长度
-
-    // 遍历索引表
-    for (i = 0; i < (sizeof(g_font_dot_matrix_16_index) /
-sizeof(g_font_dot_matrix_16_index[0])); i++)
-    {
-        // 根据字符长度匹配
-        if (strncmp(g_font_dot_matrix_16_index[i], target, charLen) == 0)
-        {
-            // 返回索引值
-            return i;
-        }
-    }
-    // 没有找到
-    return -1;
-}
-
-// 示例用法
-const char *target = "中";
-int index = FindFontIndex(target);
-if (index != -1)
-{
-    const unsigned char *dotMatrix = g_font_dot_matrix_16[index];
-    // 使用 dotMatrix 进行渲染或其他用途
-}
-*/
-const char* g_font_dot_matrix_16_index[162] = {
-
-    " ",  "!",  "\"", "#",  "$",  "%",  "&",  "'",  "(",  ")",  "*",  "+",
-    ",",  "-",  ".",  "/",  "0",  "1",  "2",  "3",  "4",  "5",  "6",  "7",
-    "8",  "9",  ":",  ";",  "<",  "=",  ">",  "?",  "@",  "A",  "B",  "C",
-    "D",  "E",  "F",  "G",  "H",  "I",  "J",  "K",  "L",  "M",  "N",  "O",
-    "P",  "Q",  "R",  "S",  "T",  "U",  "V",  "W",  "X",  "Y",  "Z",  "[",
-    "\\", "]",  "^",  "_",  "`",  "a",  "b",  "c",  "d",  "e",  "f",  "g",
-    "h",  "i",  "j",  "k",  "l",  "m",  "n",  "o",  "p",  "q",  "r",  "s",
-    "t",  "u",  "v",  "w",  "x",  "y",  "z",  "{",  "|",  "}",  "~",  "，",
-    "。", "、", "；", "：", "！", "？", "「", "」", "『", "』", "（", "）",
-    "《", "》", "【", "】", "｛", "｝", "［", "］", "〖", "〗", "·",  "…",
-    "—",  "～", "｜", "／", "＼", "＊", "＃", "＆", "％", "＠", "※",  "§",
-    "¶",  "†",  "‡",  "〃", "々", "〆", "〇", "模", "式", "停", "止", "循",
-    "迹", "避", "障", "遥", "控", "连", "接", "中", "成", "功", "失", "败",
-    "等", "待", "热", "点", "配", "置",
+const uint16_t g_font_dot_matrix_16_code[162] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00A7,
+    0x00B6, 0x00B7, 0x2014, 0x2020, 0x2021, 0x2026, 0x203B, 0x3001,
+    0x3002, 0x3003, 0x3005, 0x3006, 0x3007, 0x300A, 0x300B, 0x300C,
+    0x300D, 0x300E, 0x300F, 0x3010, 0x3011, 0x3016, 0x3017, 0x4E2D,
+    0x505C, 0x529F, 0x5931, 0x5F0F, 0x5F85, 0x5FAA, 0x6210, 0x63A5,
+    0x63A7, 0x6A21, 0x6B62, 0x70B9, 0x70ED, 0x7B49, 0x7F6E, 0x8D25,
+    0x8FDE, 0x8FF9, 0x9065, 0x907F, 0x914D, 0x969C, 0xFF01, 0xFF03,
+    0xFF05, 0xFF06, 0xFF08, 0xFF09, 0xFF0A, 0xFF0C, 0xFF0F, 0xFF1A,
+    0xFF1B, 0xFF1F, 0xFF20, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF5B, 0xFF5C,
+    0xFF5D, 0xFF5E,
 };
 
-const char g_font_dot_matrix_16[162][32] = {
-
-    /* " ", 0 */
+const uint8_t g_font_dot_matrix_16[162][32] = {
+    /* " " U+0020, 0 */
     {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "!", 1 */
+    /* "!" U+0021, 1 */
     {
         0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* """, 2 */
+    /* """ U+0022, 2 */
     {
         0x00, 0x10, 0x0C, 0x12, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "#", 3 */
+    /* "#" U+0023, 3 */
     {
         0x00, 0x20, 0xE0, 0x38, 0x20, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1F, 0x02, 0x02, 0x1F,
         0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "$", 4 */
+    /* "$" U+0024, 4 */
     {
         0x00, 0x30, 0x48, 0x88, 0xFC, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x10, 0x7F, 0x11,
         0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "%", 5 */
+    /* "%" U+0025, 5 */
     {
         0xF0, 0x08, 0xF0, 0x80, 0x60, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x06, 0x01, 0x0F, 0x10,
         0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "&", 6 */
+    /* "&" U+0026, 6 */
     {
         0x00, 0xF0, 0x88, 0x48, 0x30, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x13, 0x14, 0x08, 0x17,
         0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "'", 7 */
+    /* "'" U+0027, 7 */
     {
         0x00, 0x12, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "(", 8 */
+    /* "(" U+0028, 8 */
     {
         0x00, 0x00, 0x00, 0xE0, 0x18, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x10,
         0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* ")", 9 */
+    /* ")" U+0029, 9 */
     {
         0x02, 0x04, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0C, 0x03, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "*", 10 */
+    /* "*" U+002A, 10 */
     {
         0x40, 0x40, 0x80, 0xF0, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x0F, 0x01, 0x02,
         0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "+", 11 */
+    /* "+" U+002B, 11 */
     {
         0x00, 0x80, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* ",", 12 */
+    /* "," U+002C, 12 */
     {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x38, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "-", 13 */
+    /* "-" U+002D, 13 */
     {
         0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* ".", 14 */
+    /* "." U+002E, 14 */
     {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "/", 15 */
+    /* "/" U+002F, 15 */
     {
         0x00, 0x00, 0x00, 0x80, 0x60, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "0", 16 */
+    /* "0" U+0030, 16 */
     {
         0x00, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x08,
         0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "1", 17 */
+    /* "1" U+0031, 17 */
     {
         0x00, 0x10, 0x10, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "2", 18 */
+    /* "2" U+0032, 18 */
     {
         0x00, 0x30, 0x08, 0x08, 0x08, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x12, 0x11, 0x10,
         0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "3", 19 */
+    /* "3" U+0033, 19 */
     {
         0x00, 0x30, 0x08, 0x88, 0x88, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x10, 0x10, 0x11,
         0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "4", 20 */
+    /* "4" U+0034, 20 */
     {
         0x00, 0x00, 0x80, 0x40, 0x30, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x12, 0x12, 0x1F,
         0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "5", 21 */
+    /* "5" U+0035, 21 */
     {
         0x00, 0xF8, 0x48, 0x48, 0x48, 0x48, 0x88, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x10, 0x10, 0x10,
         0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "6", 22 */
+    /* "6" U+0036, 22 */
     {
         0x00, 0xE0, 0x90, 0x48, 0x48, 0x50, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x10,
         0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "7", 23 */
+    /* "7" U+0037, 23 */
     {
         0x00, 0x18, 0x08, 0x08, 0xC8, 0x28, 0x18, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "8", 24 */
+    /* "8" U+0038, 24 */
     {
         0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x11, 0x10, 0x10, 0x11,
         0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "9", 25 */
+    /* "9" U+0039, 25 */
     {
         0x00, 0xF0, 0x08, 0x08, 0x08, 0x90, 0xE0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x11, 0x08,
         0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* ":", 26 */
+    /* ":" U+003A, 26 */
     {
         0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* ";", 27 */
+    /* ";" U+003B, 27 */
     {
         0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "<", 28 */
+    /* "<" U+003C, 28 */
     {
         0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "=", 29 */
+    /* "=" U+003D, 29 */
     {
         0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
         0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* ">", 30 */
+    /* ">" U+003E, 30 */
     {
         0x00, 0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
         0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "?", 31 */
+    /* "?" U+003F, 31 */
     {
         0x00, 0x70, 0x08, 0x08, 0x08, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1B, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "@", 32 */
+    /* "@" U+0040, 32 */
     {
         0xE0, 0x10, 0xC8, 0x28, 0xE8, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x13, 0x14, 0x17, 0x14,
         0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "A", 33 */
+    /* "A" U+0041, 33 */
     {
         0x00, 0x00, 0xE0, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1E, 0x13, 0x02, 0x13, 0x1E,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "B", 34 */
+    /* "B" U+0042, 34 */
     {
         0x08, 0xF8, 0x88, 0x88, 0x88, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x10, 0x10, 0x11,
         0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "C", 35 */
+    /* "C" U+0043, 35 */
     {
         0xE0, 0x10, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x10, 0x08,
         0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "D", 36 */
+    /* "D" U+0044, 36 */
     {
         0x08, 0xF8, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x10, 0x10, 0x08,
         0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "E", 37 */
+    /* "E" U+0045, 37 */
     {
         0x08, 0xF8, 0x88, 0x88, 0xE8, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x10, 0x13, 0x10,
         0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "F", 38 */
+    /* "F" U+0046, 38 */
     {
         0x08, 0xF8, 0x88, 0x88, 0xE8, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x03, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "G", 39 */
+    /* "G" U+0047, 39 */
     {
         0xE0, 0x10, 0x08, 0x08, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x12, 0x0E,
         0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "H", 40 */
+    /* "H" U+0048, 40 */
     {
         0x08, 0xF8, 0x88, 0x80, 0x88, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x10, 0x1F,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "I", 41 */
+    /* "I" U+0049, 41 */
     {
         0x00, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "J", 42 */
+    /* "J" U+004A, 42 */
     {
         0x00, 0x00, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x40, 0x40, 0x3F, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "K", 43 */
+    /* "K" U+004B, 43 */
     {
         0x08, 0xF8, 0x88, 0xC0, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x01, 0x16, 0x18,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "L", 44 */
+    /* "L" U+004C, 44 */
     {
         0x08, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x10, 0x10, 0x10,
         0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "M", 45 */
+    /* "M" U+004D, 45 */
     {
         0x08, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "N", 46 */
+    /* "N" U+004E, 46 */
     {
         0x08, 0xF8, 0x38, 0xC0, 0x08, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x01, 0x0E, 0x1F,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "O", 47 */
+    /* "O" U+004F, 47 */
     {
         0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x10, 0x08,
         0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "P", 48 */
+    /* "P" U+0050, 48 */
     {
         0x08, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "Q", 49 */
+    /* "Q" U+0051, 49 */
     {
         0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x14, 0x14, 0x18, 0x28,
         0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "R", 50 */
+    /* "R" U+0052, 50 */
     {
         0x08, 0xF8, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x01, 0x06, 0x18,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "S", 51 */
+    /* "S" U+0053, 51 */
     {
         0x00, 0x70, 0x88, 0x88, 0x08, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x10, 0x10, 0x11, 0x11,
         0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "T", 52 */
+    /* "T" U+0054, 52 */
     {
         0x18, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "U", 53 */
+    /* "U" U+0055, 53 */
     {
         0x08, 0xF8, 0x08, 0x00, 0x08, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x10, 0x0F,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "V", 54 */
+    /* "V" U+0056, 54 */
     {
         0x08, 0x78, 0x88, 0x00, 0x88, 0x78, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x07, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "W", 55 */
+    /* "W" U+0057, 55 */
     {
         0x08, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x1F, 0x01,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "X", 56 */
+    /* "X" U+0058, 56 */
     {
         0x08, 0x18, 0x68, 0x80, 0x68, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x16, 0x01, 0x16, 0x18,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "Y", 57 */
+    /* "Y" U+0059, 57 */
     {
         0x08, 0x38, 0xC8, 0x00, 0xC8, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "Z", 58 */
+    /* "Z" U+005A, 58 */
     {
         0x00, 0x10, 0x08, 0x08, 0xC8, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x13, 0x10, 0x10,
         0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "[", 59 */
+    /* "[" U+005B, 59 */
     {
         0x00, 0x00, 0x00, 0xFE, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x20,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "\", 60 */
+    /* "\\" U+005C, 60 */
     {
         0x00, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x38,
         0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "]", 61 */
+    /* "]" U+005D, 61 */
     {
         0x00, 0x02, 0x02, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x3F, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "^", 62 */
+    /* "^" U+005E, 62 */
     {
         0x00, 0x00, 0x04, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "_", 63 */
+    /* "_" U+005F, 63 */
     {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
         0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "`", 64 */
+    /* "`" U+0060, 64 */
     {
         0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "a", 65 */
+    /* "a" U+0061, 65 */
     {
         0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0x09, 0x1F,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "b", 66 */
+    /* "b" U+0062, 66 */
     {
         0x04, 0xFC, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x10, 0x10, 0x10,
         0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "c", 67 */
+    /* "c" U+0063, 67 */
     {
         0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x10,
         0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "d", 68 */
+    /* "d" U+0064, 68 */
     {
         0x00, 0x80, 0x40, 0x40, 0x40, 0x44, 0xFC, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x10, 0x08,
         0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "e", 69 */
+    /* "e" U+0065, 69 */
     {
         0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x12,
         0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "f", 70 */
+    /* "f" U+0066, 70 */
     {
         0x00, 0x40, 0x40, 0xF8, 0x44, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "g", 71 */
+    /* "g" U+0067, 71 */
     {
         0x00, 0x80, 0x40, 0x40, 0x40, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x4A, 0x4A, 0x4A, 0x49,
         0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "h", 72 */
+    /* "h" U+0068, 72 */
     {
         0x04, 0xFC, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x00, 0x10,
         0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "i", 73 */
+    /* "i" U+0069, 73 */
     {
         0x00, 0x40, 0x4C, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "j", 74 */
+    /* "j" U+006A, 74 */
     {
         0x00, 0x00, 0x00, 0x40, 0x4C, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x40, 0x40, 0x3F,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "k", 75 */
+    /* "k" U+006B, 75 */
     {
         0x04, 0xFC, 0x00, 0x00, 0xC0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x12, 0x01, 0x16, 0x18,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "l", 76 */
+    /* "l" U+006C, 76 */
     {
         0x00, 0x04, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "m", 77 */
+    /* "m" U+006D, 77 */
     {
         0x40, 0xC0, 0x40, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "n", 78 */
+    /* "n" U+006E, 78 */
     {
         0x40, 0xC0, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x00, 0x10,
         0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "o", 79 */
+    /* "o" U+006F, 79 */
     {
         0x00, 0x00, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x10, 0x08,
         0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "p", 80 */
+    /* "p" U+0070, 80 */
     {
         0x40, 0xC0, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x48, 0x10, 0x10, 0x10,
         0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "q", 81 */
+    /* "q" U+0071, 81 */
     {
         0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x10, 0x48,
         0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "r", 82 */
+    /* "r" U+0072, 82 */
     {
         0x40, 0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "s", 83 */
+    /* "s" U+0073, 83 */
     {
         0x00, 0x80, 0x40, 0x40, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x12, 0x12, 0x12, 0x0C,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "t", 84 */
+    /* "t" U+0074, 84 */
     {
         0x00, 0x40, 0x40, 0xF0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x10,
         0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "u", 85 */
+    /* "u" U+0075, 85 */
     {
         0x40, 0xC0, 0x00, 0x00, 0x00, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x10, 0x08,
         0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "v", 86 */
+    /* "v" U+0076, 86 */
     {
         0x40, 0xC0, 0x40, 0x00, 0x40, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x18, 0x06, 0x01,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "w", 87 */
+    /* "w" U+0077, 87 */
     {
         0x40, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1C, 0x03, 0x1C, 0x03,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "x", 88 */
+    /* "x" U+0078, 88 */
     {
         0x00, 0x40, 0xC0, 0x40, 0x00, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x07, 0x17, 0x18,
         0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "y", 89 */
+    /* "y" U+0079, 89 */
     {
         0x40, 0xC0, 0x40, 0x00, 0x00, 0x40, 0xC0, 0x40, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x43, 0x3C, 0x0C, 0x03,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "z", 90 */
+    /* "z" U+007A, 90 */
     {
         0x00, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x16, 0x11, 0x10,
         0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "{", 91 */
+    /* "{" U+007B, 91 */
     {
         0x00, 0x00, 0x00, 0x00, 0x80, 0x7E, 0x02, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
         0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "|", 92 */
+    /* "|" U+007C, 92 */
     {
         0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "}", 93 */
+    /* "}" U+007D, 93 */
     {
         0x00, 0x02, 0x7E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "~", 94 */
+    /* "~" U+007E, 94 */
     {
         0x00, 0x02, 0x01, 0x02, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "，", 95 */
+    /* "§" U+00A7, 95 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x16, 0x0E,
+        0x00, 0x00, 0x00, 0x00, 0xC6, 0x29, 0x11, 0x11, 0x11, 0x21, 0xC2,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x21,
+        0x22, 0x22, 0x22, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "¶" U+00B6, 96 */
+    {
+        0x38, 0x7C, 0x7C, 0xFC, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "。", 96 */
+    /* "·" U+00B7, 97 */
     {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09,
-        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "、", 97 */
+    /* "—" U+2014, 98 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x18,
+        0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+        0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "；", 98 */
+    /* "†" U+2020, 99 */
     {
-        0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x16, 0x0E,
+        0x00, 0x30, 0x20, 0xFC, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "：", 99 */
+    /* "‡" U+2021, 100 */
     {
-        0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C,
+        0x00, 0x10, 0x10, 0xFE, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x7F, 0x0C, 0x18,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "！", 100 */
+    /* "…" U+2026, 101 */
     {
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19,
+        0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0,
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "？", 101 */
+    /* "※" U+203B, 102 */
     {
-        0x00, 0x00, 0x00, 0x38, 0x34, 0x02, 0x82, 0xC2, 0x7C, 0x38, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xC2, 0xC4, 0x08, 0x10, 0x20, 0xC6, 0xC6, 0x20, 0x10,
+        0x08, 0xC4, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
+        0x01, 0x18, 0x18, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
     },
-    /* "「", 102 */
+    /* "、" U+3001, 103 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "」", 103 */
+    /* "。" U+3002, 104 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
-        0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09,
+        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "『", 104 */
+    /* "〃" U+3003, 105 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x05,
-        0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1F, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x00, 0xC0, 0x38, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "』", 105 */
+    /* "々" U+3005, 106 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x14, 0x17,
-        0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x0E, 0x08, 0x88, 0x48, 0x28,
+        0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x02, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "（", 106 */
+    /* "〆" U+3006, 107 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x04,
-        0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x06, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x20, 0xA1, 0x72,
+        0x8E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+        0x10, 0x0C, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "）", 107 */
+    /* "〇" U+3007, 108 */
     {
-        0x00, 0x00, 0x00, 0x02, 0x04, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xE0, 0x18, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04,
+        0x04, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x08, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x06, 0x01, 0x00, 0x00,
     },
-    /* "《", 108 */
+    /* "《" U+300A, 109 */
     {
         0x00, 0x00, 0x00, 0x40, 0xA0, 0x10, 0x48, 0xA4, 0x12, 0x09, 0x04,
         0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
         0x02, 0x04, 0x09, 0x12, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "》", 109 */
+    /* "》" U+300B, 110 */
     {
         0x00, 0x00, 0x00, 0x02, 0x04, 0x09, 0x12, 0xA4, 0x48, 0x10, 0xA0,
         0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x12,
         0x09, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "【", 110 */
+    /* "「" U+300C, 111 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F,
-        0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1F, 0x1F, 0x1F, 0x1E, 0x18, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "】", 111 */
+    /* "」" U+300D, 112 */
     {
-        0x00, 0x00, 0x01, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1E, 0x1F,
-        0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
+        0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "｛", 112 */
+    /* "『" U+300E, 113 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA0, 0x1E,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x05,
+        0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1F, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "｝", 113 */
+    /* "』" U+300F, 114 */
     {
-        0x00, 0x00, 0x00, 0x01, 0x1E, 0xA0, 0x40, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x14, 0x17,
+        0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "［", 114 */
+    /* "【" U+3010, 115 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-        0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F,
+        0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1F, 0x1F, 0x1F, 0x1E, 0x18, 0x10, 0x00, 0x00, 0x00,
     },
-    /* "］", 115 */
+    /* "】" U+3011, 116 */
     {
-        0x00, 0x00, 0x02, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1E, 0x1F,
+        0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "〖", 116 */
+    /* "〖" U+3016, 117 */
     {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0xF1, 0x0D,
         0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x1F, 0x10, 0x10, 0x11, 0x16, 0x18, 0x10, 0x00, 0x00, 0x00,
     },
-    /* "〗", 117 */
+    /* "〗" U+3017, 118 */
     {
         0x00, 0x00, 0x01, 0x03, 0x0D, 0xF1, 0x01, 0x01, 0xFF, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x16, 0x11,
         0x10, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "·", 118 */
-    {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    },
-    /* "…", 119 */
+    /* "中" U+4E2D, 119 */
     {
-        0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0,
-        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFC, 0x04, 0x04, 0x04, 0x04, 0xFF, 0x04, 0x04, 0x04,
+        0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01,
+        0x01, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00,
     },
-    /* "—", 120 */
+    /* "停" U+505C, 120 */
     {
-        0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
-        0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0x20, 0xF8, 0x07, 0x82, 0xBA, 0xAA, 0xAA, 0xAB, 0xAA,
+        0xAA, 0xBA, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01,
+        0x02, 0x02, 0x22, 0x22, 0x3E, 0x02, 0x02, 0x01, 0x00, 0x00,
     },
-    /* "～", 121 */
+    /* "功" U+529F, 121 */
     {
-        0x00, 0x80, 0x40, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x80, 0x80,
-        0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x00, 0x08, 0xFF, 0x08, 0x08,
+        0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x03, 0x02, 0x22,
+        0x10, 0x0C, 0x03, 0x00, 0x20, 0x20, 0x1F, 0x00, 0x00, 0x00,
     },
-    /* "｜", 122 */
+    /* "失" U+5931, 122 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xA0, 0x90, 0x8E, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x88,
+        0x88, 0x80, 0x80, 0x00, 0x00, 0x00, 0x20, 0x20, 0x10, 0x08, 0x04,
+        0x03, 0x00, 0x03, 0x04, 0x08, 0x10, 0x20, 0x20, 0x00, 0x00,
     },
-    /* "／", 123 */
+    /* "式" U+5F0F, 123 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10,
-        0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x48, 0x48, 0xC8, 0x48, 0x48, 0x08, 0x08, 0xFF, 0x08,
+        0x09, 0x0A, 0x08, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x08,
+        0x08, 0x08, 0x00, 0x01, 0x06, 0x08, 0x10, 0x3C, 0x00, 0x00,
     },
-    /* "＼", 124 */
+    /* "待" U+5F85, 124 */
     {
-        0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
+        0x00, 0x88, 0x44, 0xE2, 0x19, 0x20, 0x24, 0x24, 0x24, 0x3F, 0x24,
+        0xE4, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01,
+        0x05, 0x09, 0x01, 0x21, 0x21, 0x3F, 0x01, 0x01, 0x00, 0x00,
     },
-    /* "＊", 125 */
+    /* "循" U+5FAA, 125 */
     {
-        0x00, 0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x7E, 0x80, 0x40, 0x20,
-        0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x01,
-        0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00,
+        0x00, 0x10, 0x88, 0xC4, 0x33, 0x00, 0xFE, 0x12, 0xD2, 0x52, 0x7F,
+        0x51, 0xD1, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x20,
+        0x1F, 0x00, 0x3F, 0x15, 0x15, 0x15, 0x3F, 0x00, 0x00, 0x00,
     },
-    /* "＃", 126 */
+    /* "成" U+6210, 126 */
     {
-        0x00, 0x00, 0x10, 0x10, 0x10, 0xF0, 0x1E, 0x10, 0x10, 0xF0, 0x1E,
-        0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x1E, 0x03,
-        0x02, 0x02, 0x1E, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xF8, 0x48, 0x48, 0x48, 0xC8, 0x08, 0x08, 0xFF, 0x08,
+        0x09, 0xEA, 0x08, 0x00, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x08, 0x08,
+        0x07, 0x20, 0x10, 0x0B, 0x04, 0x0B, 0x10, 0x3C, 0x00, 0x00,
     },
-    /* "＆", 127 */
+    /* "接" U+63A5, 127 */
     {
-        0x00, 0x00, 0x00, 0x18, 0xA4, 0x42, 0xA2, 0x12, 0x0C, 0x80, 0x80,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x10, 0x10,
-        0x10, 0x11, 0x0A, 0x04, 0x0B, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x08, 0xFF, 0x88, 0x28, 0x24, 0x2C, 0xF5, 0x26, 0x34,
+        0x2C, 0x24, 0x20, 0x00, 0x00, 0x00, 0x21, 0x21, 0x3F, 0x00, 0x21,
+        0x25, 0x17, 0x09, 0x09, 0x15, 0x13, 0x21, 0x01, 0x00, 0x00,
     },
-    /* "％", 128 */
+    /* "控" U+63A7, 128 */
     {
-        0x00, 0x00, 0x00, 0x3E, 0x41, 0x41, 0x3E, 0x80, 0x40, 0x20, 0x90,
-        0x88, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
-        0x01, 0x00, 0x00, 0x1F, 0x20, 0x20, 0x1F, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x08, 0xFF, 0x88, 0x00, 0x4C, 0x24, 0x15, 0x06, 0x04,
+        0x14, 0x24, 0x4C, 0x00, 0x00, 0x00, 0x21, 0x21, 0x3F, 0x00, 0x00,
+        0x20, 0x21, 0x21, 0x3F, 0x21, 0x21, 0x21, 0x20, 0x00, 0x00,
     },
-    /* "＠", 129 */
+    /* "模" U+6A21, 129 */
     {
-        0x00, 0x00, 0x00, 0xE4, 0x12, 0x12, 0x22, 0xF2, 0x02, 0x04, 0xF8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08,
-        0x04, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0xC8, 0xFF, 0x48, 0x80, 0xF4, 0x5F, 0x54, 0x54, 0x54,
+        0x5F, 0xF4, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x24,
+        0x25, 0x15, 0x0D, 0x07, 0x0D, 0x15, 0x25, 0x24, 0x00, 0x00,
     },
-    /* "※", 130 */
+    /* "止" U+6B62, 130 */
     {
-        0x00, 0x00, 0xC2, 0xC4, 0x08, 0x10, 0x20, 0xC6, 0xC6, 0x20, 0x10,
-        0x08, 0xC4, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
-        0x01, 0x18, 0x18, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x20,
+        0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x3F, 0x20,
+        0x20, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
     },
-    /* "§", 131 */
+    /* "点" U+70B9, 131 */
     {
-        0x00, 0x00, 0x00, 0x00, 0xC6, 0x29, 0x11, 0x11, 0x11, 0x21, 0xC2,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x21,
-        0x22, 0x22, 0x22, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE0, 0x20, 0x20, 0x3F, 0x24, 0x24, 0x24, 0x24,
+        0xE4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x03, 0x02, 0x0A,
+        0x32, 0x02, 0x0A, 0x32, 0x02, 0x03, 0x08, 0x30, 0x00, 0x00,
     },
-    /* "¶", 132 */
+    /* "热" U+70ED, 132 */
     {
-        0x38, 0x7C, 0x7C, 0xFC, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x24, 0x24, 0xFF, 0x14, 0x00, 0x24, 0xC4, 0xBF, 0x04,
+        0xFC, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x1A, 0x02, 0x03, 0x08,
+        0x32, 0x01, 0x08, 0x31, 0x00, 0x00, 0x09, 0x33, 0x00, 0x00,
     },
-    /* "†", 133 */
+    /* "等" U+7B49, 133 */
     {
-        0x00, 0x30, 0x20, 0xFC, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x88, 0x84, 0xA3, 0xA6, 0xAA, 0xA2, 0xF8, 0xA4, 0xA3, 0xA2,
+        0xA6, 0x8A, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0A, 0x12,
+        0x02, 0x22, 0x22, 0x3F, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
     },
-    /* "‡", 134 */
+    /* "置" U+7F6E, 134 */
     {
-        0x00, 0x10, 0x10, 0xFE, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x7F, 0x0C, 0x18,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2F, 0xA9, 0xA9, 0xAF, 0xA9, 0xF9, 0xA9, 0xAF, 0xA9,
+        0xA9, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20,
+        0x20, 0x3C, 0x20, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00,
     },
-    /* "〃", 135 */
+    /* "败" U+8D25, 135 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x00, 0xC0, 0x38, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-        0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xFE, 0x02, 0xFA, 0x02, 0xFE, 0x20, 0x10, 0xEF, 0x08, 0x08,
+        0x08, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x23, 0x18, 0x07, 0x08, 0x13,
+        0x20, 0x20, 0x10, 0x0B, 0x04, 0x0B, 0x10, 0x20, 0x00, 0x00,
     },
-    /* "々", 136 */
+    /* "连" U+8FDE, 136 */
     {
-        0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x0E, 0x08, 0x88, 0x48, 0x28,
-        0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x02, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0x42, 0xCC, 0x00, 0x44, 0x74, 0x4C, 0x47, 0xF4, 0x44,
+        0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x10, 0x22,
+        0x22, 0x22, 0x22, 0x3F, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00,
     },
-    /* "〆", 137 */
+    /* "迹" U+8FF9, 137 */
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x20, 0xA1, 0x72,
-        0x8E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
-        0x10, 0x0C, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0x42, 0xCC, 0x00, 0x00, 0xC8, 0x08, 0xF8, 0x09, 0x0A,
+        0xF8, 0x48, 0x88, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x10, 0x21,
+        0x28, 0x26, 0x21, 0x28, 0x28, 0x2F, 0x20, 0x21, 0x00, 0x00,
     },
-    /* "〇", 138 */
+    /* "遥" U+9065, 138 */
     {
-        0x00, 0x00, 0xE0, 0x18, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04,
-        0x04, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x08, 0x08,
-        0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x06, 0x01, 0x00, 0x00,
+        0x00, 0x20, 0x21, 0xE6, 0x00, 0x42, 0x36, 0x2A, 0x26, 0xEA, 0x22,
+        0x29, 0x27, 0x01, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x10, 0x21,
+        0x2D, 0x29, 0x29, 0x2F, 0x29, 0x29, 0x2D, 0x21, 0x00, 0x00,
     },
-    /* "模", 139 */
+    /* "避" U+907F, 139 */
     {
-        0x00, 0x08, 0xC8, 0xFF, 0x48, 0x80, 0xF4, 0x5F, 0x54, 0x54, 0x54,
-        0x5F, 0xF4, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x24,
-        0x25, 0x15, 0x0D, 0x07, 0x0D, 0x15, 0x25, 0x24, 0x00, 0x00,
+        0x00, 0x20, 0x21, 0xE6, 0x00, 0xFE, 0x92, 0x92, 0x9E, 0x44, 0x55,
+        0xE6, 0x54, 0x44, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x12, 0x21,
+        0x27, 0x24, 0x27, 0x20, 0x21, 0x2F, 0x21, 0x20, 0x00, 0x00,
     },
-    /* "式", 140 */
+    /* "配" U+914D, 140 */
     {
-        0x00, 0x08, 0x48, 0x48, 0xC8, 0x48, 0x48, 0x08, 0x08, 0xFF, 0x08,
-        0x09, 0x0A, 0x08, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x08,
-        0x08, 0x08, 0x00, 0x01, 0x06, 0x08, 0x10, 0x3C, 0x00, 0x00,
+        0x00, 0xF2, 0x92, 0x7E, 0x12, 0x7E, 0x92, 0xF2, 0x00, 0xC2, 0x42,
+        0x42, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x12, 0x12, 0x12, 0x12,
+        0x12, 0x3F, 0x00, 0x1F, 0x20, 0x20, 0x20, 0x38, 0x00, 0x00,
     },
-    /* "停", 141 */
+    /* "障" U+969C, 141 */
     {
-        0x00, 0x40, 0x20, 0xF8, 0x07, 0x82, 0xBA, 0xAA, 0xAA, 0xAB, 0xAA,
-        0xAA, 0xBA, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01,
-        0x02, 0x02, 0x22, 0x22, 0x3E, 0x02, 0x02, 0x01, 0x00, 0x00,
+        0x00, 0xFE, 0x02, 0x32, 0xCE, 0x00, 0xEA, 0xAE, 0xAA, 0xAB, 0xAA,
+        0xAE, 0xEA, 0x08, 0x00, 0x00, 0x00, 0x3F, 0x04, 0x04, 0x03, 0x08,
+        0x0B, 0x0A, 0x0A, 0x3E, 0x0A, 0x0A, 0x0B, 0x08, 0x00, 0x00,
     },
-    /* "止", 142 */
+    /* "！" U+FF01, 142 */
     {
-        0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x20,
-        0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x3F, 0x20,
-        0x20, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "循", 143 */
+    /* "＃" U+FF03, 143 */
     {
-        0x00, 0x10, 0x88, 0xC4, 0x33, 0x00, 0xFE, 0x12, 0xD2, 0x52, 0x7F,
-        0x51, 0xD1, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x00, 0x20,
-        0x1F, 0x00, 0x3F, 0x15, 0x15, 0x15, 0x3F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x10, 0x10, 0xF0, 0x1E, 0x10, 0x10, 0xF0, 0x1E,
+        0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x1E, 0x03,
+        0x02, 0x02, 0x1E, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
     },
-    /* "迹", 144 */
+    /* "％" U+FF05, 144 */
     {
-        0x00, 0x40, 0x42, 0xCC, 0x00, 0x00, 0xC8, 0x08, 0xF8, 0x09, 0x0A,
-        0xF8, 0x48, 0x88, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x10, 0x21,
-        0x28, 0x26, 0x21, 0x28, 0x28, 0x2F, 0x20, 0x21, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3E, 0x41, 0x41, 0x3E, 0x80, 0x40, 0x20, 0x90,
+        0x88, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
+        0x01, 0x00, 0x00, 0x1F, 0x20, 0x20, 0x1F, 0x00, 0x00, 0x00,
     },
-    /* "避", 145 */
+    /* "＆" U+FF06, 145 */
     {
-        0x00, 0x20, 0x21, 0xE6, 0x00, 0xFE, 0x92, 0x92, 0x9E, 0x44, 0x55,
-        0xE6, 0x54, 0x44, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x12, 0x21,
-        0x27, 0x24, 0x27, 0x20, 0x21, 0x2F, 0x21, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0xA4, 0x42, 0xA2, 0x12, 0x0C, 0x80, 0x80,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x10, 0x10,
+        0x10, 0x11, 0x0A, 0x04, 0x0B, 0x10, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "障", 146 */
+    /* "（" U+FF08, 146 */
     {
-        0x00, 0xFE, 0x02, 0x32, 0xCE, 0x00, 0xEA, 0xAE, 0xAA, 0xAB, 0xAA,
-        0xAE, 0xEA, 0x08, 0x00, 0x00, 0x00, 0x3F, 0x04, 0x04, 0x03, 0x08,
-        0x0B, 0x0A, 0x0A, 0x3E, 0x0A, 0x0A, 0x0B, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x04,
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x06, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "遥", 147 */
+    /* "）" U+FF09, 147 */
     {
-        0x00, 0x20, 0x21, 0xE6, 0x00, 0x42, 0x36, 0x2A, 0x26, 0xEA, 0x22,
-        0x29, 0x27, 0x01, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x10, 0x21,
-        0x2D, 0x29, 0x29, 0x2F, 0x29, 0x29, 0x2D, 0x21, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0x04, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "控", 148 */
+    /* "＊" U+FF0A, 148 */
     {
-        0x00, 0x08, 0x08, 0xFF, 0x88, 0x00, 0x4C, 0x24, 0x15, 0x06, 0x04,
-        0x14, 0x24, 0x4C, 0x00, 0x00, 0x00, 0x21, 0x21, 0x3F, 0x00, 0x00,
-        0x20, 0x21, 0x21, 0x3F, 0x21, 0x21, 0x21, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x7E, 0x80, 0x40, 0x20,
+        0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x01,
+        0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00,
     },
-    /* "连", 149 */
+    /* "，" U+FF0C, 149 */
     {
-        0x00, 0x40, 0x42, 0xCC, 0x00, 0x44, 0x74, 0x4C, 0x47, 0xF4, 0x44,
-        0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0F, 0x10, 0x22,
-        0x22, 0x22, 0x22, 0x3F, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x16, 0x0E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "接", 150 */
+    /* "／" U+FF0F, 150 */
     {
-        0x00, 0x08, 0x08, 0xFF, 0x88, 0x28, 0x24, 0x2C, 0xF5, 0x26, 0x34,
-        0x2C, 0x24, 0x20, 0x00, 0x00, 0x00, 0x21, 0x21, 0x3F, 0x00, 0x21,
-        0x25, 0x17, 0x09, 0x09, 0x15, 0x13, 0x21, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10,
+        0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "中", 151 */
+    /* "：" U+FF1A, 151 */
     {
-        0x00, 0x00, 0xFC, 0x04, 0x04, 0x04, 0x04, 0xFF, 0x04, 0x04, 0x04,
-        0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01,
-        0x01, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "成", 152 */
+    /* "；" U+FF1B, 152 */
     {
-        0x00, 0x00, 0xF8, 0x48, 0x48, 0x48, 0xC8, 0x08, 0x08, 0xFF, 0x08,
-        0x09, 0xEA, 0x08, 0x00, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x08, 0x08,
-        0x07, 0x20, 0x10, 0x0B, 0x04, 0x0B, 0x10, 0x3C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x16, 0x0E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "功", 153 */
+    /* "？" U+FF1F, 153 */
     {
-        0x00, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x00, 0x08, 0xFF, 0x08, 0x08,
-        0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x03, 0x02, 0x22,
-        0x10, 0x0C, 0x03, 0x00, 0x20, 0x20, 0x1F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x38, 0x34, 0x02, 0x82, 0xC2, 0x7C, 0x38, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "失", 154 */
+    /* "＠" U+FF20, 154 */
     {
-        0x00, 0x80, 0xA0, 0x90, 0x8E, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x88,
-        0x88, 0x80, 0x80, 0x00, 0x00, 0x00, 0x20, 0x20, 0x10, 0x08, 0x04,
-        0x03, 0x00, 0x03, 0x04, 0x08, 0x10, 0x20, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE4, 0x12, 0x12, 0x22, 0xF2, 0x02, 0x04, 0xF8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08,
+        0x04, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "败", 155 */
+    /* "［" U+FF3B, 155 */
     {
-        0x00, 0xFE, 0x02, 0xFA, 0x02, 0xFE, 0x20, 0x10, 0xEF, 0x08, 0x08,
-        0x08, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x23, 0x18, 0x07, 0x08, 0x13,
-        0x20, 0x20, 0x10, 0x0B, 0x04, 0x0B, 0x10, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+        0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x10, 0x00, 0x00, 0x00,
     },
-    /* "等", 156 */
+    /* "＼" U+FF3C, 156 */
     {
-        0x00, 0x88, 0x84, 0xA3, 0xA6, 0xAA, 0xA2, 0xF8, 0xA4, 0xA3, 0xA2,
-        0xA6, 0x8A, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0A, 0x12,
-        0x02, 0x22, 0x22, 0x3F, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
     },
-    /* "待", 157 */
+    /* "］" U+FF3D, 157 */
     {
-        0x00, 0x88, 0x44, 0xE2, 0x19, 0x20, 0x24, 0x24, 0x24, 0x3F, 0x24,
-        0xE4, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01,
-        0x05, 0x09, 0x01, 0x21, 0x21, 0x3F, 0x01, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "热", 158 */
+    /* "｛" U+FF5B, 158 */
     {
-        0x00, 0x00, 0x24, 0x24, 0xFF, 0x14, 0x00, 0x24, 0xC4, 0xBF, 0x04,
-        0xFC, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x1A, 0x02, 0x03, 0x08,
-        0x32, 0x01, 0x08, 0x31, 0x00, 0x00, 0x09, 0x33, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA0, 0x1E,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "点", 159 */
+    /* "｜" U+FF5C, 159 */
     {
-        0x00, 0x00, 0x00, 0xE0, 0x20, 0x20, 0x3F, 0x24, 0x24, 0x24, 0x24,
-        0xE4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x03, 0x02, 0x0A,
-        0x32, 0x02, 0x0A, 0x32, 0x02, 0x03, 0x08, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "配", 160 */
+    /* "｝" U+FF5D, 160 */
     {
-        0x00, 0xF2, 0x92, 0x7E, 0x12, 0x7E, 0x92, 0xF2, 0x00, 0xC2, 0x42,
-        0x42, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x12, 0x12, 0x12, 0x12,
-        0x12, 0x3F, 0x00, 0x1F, 0x20, 0x20, 0x20, 0x38, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x1E, 0xA0, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
-    /* "置", 161 */
+    /* "～" U+FF5E, 161 */
     {
-        0x00, 0x00, 0x2F, 0xA9, 0xA9, 0xAF, 0xA9, 0xF9, 0xA9, 0xAF, 0xA9,
-        0xA9, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20,
-        0x20, 0x3C, 0x20, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00,
+        0x00, 0x80, 0x40, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x80, 0x80,
+        0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     },
 };
@@ -1,7 +1,13 @@
 #ifndef FONT_DOT_MATRIX_16_H
 #define FONT_DOT_MATRIX_16_H
 
-extern const char* g_font_dot_matrix_16_index[];
-extern const char g_font_dot_matrix_16[][32];
+#include <stdint.h>
+
+#define FONT_DOT_MATRIX_16_BYTES 32  // 每个字形 16 列 x 2 页
+
+// 由 tools/gen_font16.py 生成：码点升序表与对应字形（列行扫描，低位在前）
+extern const uint16_t g_font_dot_matrix_16_count;
+extern const uint16_t g_font_dot_matrix_16_code[];
+extern const uint8_t g_font_dot_matrix_16[][FONT_DOT_MATRIX_16_BYTES];
 
 #endif
@@ -32,6 +32,11 @@
 #define SSD1306_CTRL_DATA 0x40
 #define SSD1306_MASK_CONT (0x1 << 7)
 #define DOUBLE 2
+#define SSD1306_PAGES (SSD1306_HEIGHT / 8)
+#define SSD1306_WINDOW_CMD_LEN 6   // 0x21 x0 x1 0x22 p0 p1
+#define SSD1306_WINDOW_OVERHEAD (SSD1306_WINDOW_CMD_LEN * DOUBLE + 1)
+#define SSD1306_FONT_MAX_WIDTH 16  // ASCII 字体最大宽度（Font_16x26）
+#define SSD1306_FONT_MAX_PAGES 4   // ASCII 字体最大页数（26 行）
 
 void ssd1306_Reset(void) {
   // Wait for the screen to boot,1ms  The delay here is very important
@@ -80,11 +85,48 @@ static uint8_t SSD1306_Buffer[SSD1306_BUFFER_SIZE];
 // Screen object
 static SSD1306_t SSD1306;
 
+// 脏区：每页记录一段列范围 [x0, x1]，x0 > x1 表示该页无需刷新
+static uint8_t g_dirty_x0[SSD1306_PAGES];
+static uint8_t g_dirty_x1[SSD1306_PAGES];
+
+// 面板显存的镜像（已成功发送的内容），用于剔除整屏重绘后实际未变化的字节
+static uint8_t g_panel_shadow[SSD1306_BUFFER_SIZE];
+static bool g_shadow_valid = false;
+
+// 发送缓冲（窗口命令 + 数据），放在静态区避免每次刷新占用 1KB+ 栈
+static uint8_t g_tx_buf[SSD1306_WINDOW_OVERHEAD + SSD1306_BUFFER_SIZE];
+
+static inline void ssd1306_MarkDirty(uint32_t page, uint8_t x) {
+  if (x < g_dirty_x0[page]) g_dirty_x0[page] = x;
+  if (x > g_dirty_x1[page]) g_dirty_x1[page] = x;
+}
+
+static inline bool ssd1306_PageDirty(uint32_t page) {
+  return g_dirty_x0[page] <= g_dirty_x1[page];
+}
+
+static inline void ssd1306_ClearDirty(uint32_t page) {
+  g_dirty_x0[page] = UINT8_MAX;
+  g_dirty_x1[page] = 0;
+}
+
+void ssd1306_Invalidate(void) {
+  for (uint32_t page = 0; page < SSD1306_PAGES; page++) {
+    g_dirty_x0[page] = 0;
+    g_dirty_x1[page] = SSD1306_WIDTH - 1;
+  }
+  g_shadow_valid = false;
+}
+
 /* Fills the Screenbuffer with values from a given buffer of a fixed length */
 SSD1306_Error_t ssd1306_FillBuffer(uint8_t* buf, uint32_t len) {
   SSD1306_Error_t ret = SSD1306_ERR;
   if (len <= SSD1306_BUFFER_SIZE) {
     memcpy_s(SSD1306_Buffer, len + 1, buf, len);
+    for (uint32_t page = 0; page < SSD1306_PAGES; page++) {
+      g_dirty_x0[page] = 0;
+      g_dirty_x1[page] = SSD1306_WIDTH - 1;
+    }
     ret = SSD1306_OK;
   }
   return ret;
@@ -193,7 +235,8 @@ bool ssd1306_Init(void) {
   // Clear screen
   ssd1306_Fill(Black);
 
-  // Flush buffer to screen
+  // Flush buffer to screen（上电后面板显存内容未知，整屏发送一次）
+  ssd1306_Invalidate();
   ssd1306_UpdateScreen();
 
   // Set default values for screen object
@@ -206,51 +249,119 @@ bool ssd1306_Init(void) {
 
 // Fill the whole screen with the given color
 void ssd1306_Fill(SSD1306_COLOR color) {
-  /* Set memory */
-  uint32_t i;
+  uint8_t value = (color == Black) ? 0x00 : 0xFF;
+
+  for (uint32_t i = 0; i < sizeof(SSD1306_Buffer); i++) {
+    if (SSD1306_Buffer[i] != value) {
+      SSD1306_Buffer[i] = value;
+      ssd1306_MarkDirty(i / SSD1306_WIDTH, i % SSD1306_WIDTH);
+    }
+  }
+}
 
-  for (i = 0; i < sizeof(SSD1306_Buffer); i++) {
-    SSD1306_Buffer[i] = (color == Black) ? 0x00 : 0xFF;
+/**
+ * @brief 按面板镜像收缩一页的脏区，去掉两端内容未变化的列
+ * @return true 该页仍需刷新
+ */
+static bool ssd1306_TrimDirty(uint32_t page) {
+  if (!ssd1306_PageDirty(page)) return false;
+  if (!g_shadow_valid) return true;
+
+  const uint8_t* cur = &SSD1306_Buffer[page * SSD1306_WIDTH];
+  const uint8_t* old = &g_panel_shadow[page * SSD1306_WIDTH];
+  uint8_t x0 = g_dirty_x0[page];
+  uint8_t x1 = g_dirty_x1[page];
+  while (x0 <= x1 && cur[x0] == old[x0]) x0++;
+  while (x1 > x0 && cur[x1] == old[x1]) x1--;
+  if (x0 > x1) {
+    ssd1306_ClearDirty(page);
+    return false;
   }
+  g_dirty_x0[page] = x0;
+  g_dirty_x1[page] = x1;
+  return true;
 }
 
-// Write the screenbuffer with changed to the screen
-void ssd1306_UpdateScreen(void) {
-  // Write data to each page of RAM. Number of pages
-  // depends on the screen height:
-  //
-  //  * 32px   ==  4 pages
-  //  * 64px   ==  8 pages
-  //  * 128px  ==  16 pages
-
-  uint8_t cmd[] = {
-      0X21,  // 设置列起始和结束地址
-      0X00,  // 列起始地址 0
-      0X7F,  // 列终止地址 127
-      0X22,  // 设置页起始和结束地址
-      0X00,  // 页起始地址 0
-      0X07,  // 页终止地址 7
+/**
+ * @brief 发送一个窗口（列 x0~x1，页 p0~p1）并在成功后清除这些页的脏标记
+ */
+static uint32_t ssd1306_SendWindow(uint8_t x0, uint8_t x1, uint8_t p0,
+                                   uint8_t p1) {
+  uint8_t cmd[SSD1306_WINDOW_CMD_LEN] = {
+      0X21, x0, x1,  // 设置列起始和结束地址
+      0X22, p0, p1,  // 设置页起始和结束地址
   };
+  uint32_t width = x1 - x0 + 1;
   uint32_t count = 0;
-  uint8_t data[sizeof(cmd) * DOUBLE + SSD1306_BUFFER_SIZE + 1] = {};
 
-  // copy cmd
-  for (uint32_t i = 0; i < sizeof(cmd) / sizeof(cmd[0]); i++) {
-    data[count++] = SSD1306_CTRL_CMD | SSD1306_MASK_CONT;
-    data[count++] = cmd[i];
+  for (uint32_t i = 0; i < sizeof(cmd); i++) {
+    g_tx_buf[count++] = SSD1306_CTRL_CMD | SSD1306_MASK_CONT;
+    g_tx_buf[count++] = cmd[i];
+  }
+  g_tx_buf[count++] = SSD1306_CTRL_DATA;
+  for (uint32_t page = p0; page <= p1; page++) {
+    (void)memcpy_s(&g_tx_buf[count], sizeof(g_tx_buf) - count,
+                   &SSD1306_Buffer[page * SSD1306_WIDTH + x0], width);
+    count += width;
   }
 
-  // copy frame data
-  data[count++] = SSD1306_CTRL_DATA;
-  memcpy_s(&data[count], SSD1306_BUFFER_SIZE + 1, SSD1306_Buffer,
-           SSD1306_BUFFER_SIZE);
-  count += sizeof(SSD1306_Buffer);
+  uint32_t retval = ssd1306_SendData(g_tx_buf, count);
+  if (retval != 0) return retval;  // 保留脏标记，下次刷新重试
+
+  for (uint32_t page = p0; page <= p1; page++) {
+    uint32_t offset = page * SSD1306_WIDTH + x0;
+    (void)memcpy_s(&g_panel_shadow[offset], sizeof(g_panel_shadow) - offset,
+                   &SSD1306_Buffer[offset], width);
+    ssd1306_ClearDirty(page);
+  }
+  return 0;
+}
+
+// Write the screenbuffer with changed to the screen
+void ssd1306_UpdateScreen(void) {
+  // 只发送脏区：相邻脏页的列范围合并后不比分开发送更长时合成一个窗口，
+  // 每个窗口用 0x21 / 0x22 设置地址后连续写入（水平寻址模式自动换页）
+  uint32_t retval = 0;
+  uint32_t page = 0;
+
+  while (page < SSD1306_PAGES) {
+    if (!ssd1306_TrimDirty(page)) {
+      page++;
+      continue;
+    }
+
+    uint32_t last = page;
+    uint8_t x0 = g_dirty_x0[page];
+    uint8_t x1 = g_dirty_x1[page];
+    uint32_t split = (x1 - x0 + 1) + SSD1306_WINDOW_OVERHEAD;
+    while (last + 1 < SSD1306_PAGES && ssd1306_TrimDirty(last + 1)) {
+      uint8_t nx0 = g_dirty_x0[last + 1];
+      uint8_t nx1 = g_dirty_x1[last + 1];
+      uint32_t next_split = split + (nx1 - nx0 + 1) + SSD1306_WINDOW_OVERHEAD;
+      if (nx0 > x0) nx0 = x0;
+      if (nx1 < x1) nx1 = x1;
+      uint32_t merged =
+          (nx1 - nx0 + 1) * (last + 2 - page) + SSD1306_WINDOW_OVERHEAD;
+      if (merged > next_split) break;
+      x0 = nx0;
+      x1 = nx1;
+      split = next_split;
+      last++;
+    }
+
+    uint32_t ret = ssd1306_SendWindow(x0, x1, page, last);
+    if (ret != 0) retval = ret;
+    page = last + 1;
+  }
 
-  // send to i2c bus
-  uint32_t retval = ssd1306_SendData(data, count);
   if (retval != 0) {
+    // 失败的传输可能已写入部分数据，镜像不再可信，下次按完整脏区重发
+    g_shadow_valid = false;
     printf("ssd1306_UpdateScreen send frame data filed: %d!\r\n", retval);
+    return;
   }
+  // 所有页都已成功发送，镜像与面板一致
+  g_shadow_valid = true;
 }
 
 //    Draw one pixel in the screenbuffer
@@ -270,13 +381,89 @@ void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
 
   // Draw in the right color
   uint32_t c = 8;  // 8
+  uint32_t idx = x + (y / c) * SSD1306_WIDTH;
+  uint8_t value = SSD1306_Buffer[idx];
   if (color == White) {
-    SSD1306_Buffer[x + (y / c) * SSD1306_WIDTH] |= 1 << (y % c);
+    value |= 1 << (y % c);
   } else {
-    SSD1306_Buffer[x + (y / c) * SSD1306_WIDTH] &= ~(1 << (y % c));
+    value &= ~(1 << (y % c));
+  }
+  if (value != SSD1306_Buffer[idx]) {
+    SSD1306_Buffer[idx] = value;
+    ssd1306_MarkDirty(y / c, x);
   }
 }
 
+/**
+ * @brief 按掩码写入一个显存字节，内容变化时记录脏区
+ */
+static inline void ssd1306_WriteMasked(uint32_t page, uint8_t x, uint8_t mask,
+                                       uint8_t bits) {
+  uint8_t* p = &SSD1306_Buffer[page * SSD1306_WIDTH + x];
+  uint8_t value = (uint8_t)((*p & ~mask) | (bits & mask));
+  if (value != *p) {
+    *p = value;
+    ssd1306_MarkDirty(page, x);
+  }
+}
+
+// Draw column bytes (SSD1306 page format, bit 0 = top) to the screenbuffer
+void ssd1306_DrawColumnBytes(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                             const uint8_t* data, SSD1306_COLOR color) {
+  if (data == NULL || x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT) return;
+
+  uint32_t cols = (w <= SSD1306_WIDTH - x) ? w : SSD1306_WIDTH - x;
+  uint32_t page0 = y / 8;
+  uint8_t shift = y % 8;
+
+  // 每行源数据覆盖 8 个像素行，y 未按页对齐时拆到相邻两页，用掩码只改矩形内的位
+  for (uint32_t r = 0; r * 8 < h; r++) {
+    uint32_t rows = (h - r * 8 >= 8) ? 8 : h - r * 8;
+    uint8_t mask = (uint8_t)((1u << rows) - 1);
+    uint8_t lo_mask = (uint8_t)(mask << shift);
+    uint8_t hi_mask = shift ? (uint8_t)(mask >> (8 - shift)) : 0;
+    uint32_t lo_page = page0 + r;
+    const uint8_t* src = &data[r * w];
+
+    if (lo_page >= SSD1306_PAGES) break;
+    for (uint32_t i = 0; i < cols; i++) {
+      uint8_t bits = (color == White) ? src[i] : (uint8_t)~src[i];
+      ssd1306_WriteMasked(lo_page, x + i, lo_mask, (uint8_t)(bits << shift));
+      if (hi_mask && lo_page + 1 < SSD1306_PAGES)
+        ssd1306_WriteMasked(lo_page + 1, x + i, hi_mask,
+                            (uint8_t)(bits >> (8 - shift)));
+    }
+  }
+}
+
+// Fill rectangle：按页生成位掩码整字节写入，完整覆盖的页掩码为 0xFF
+void ssd1306_FillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      SSD1306_COLOR color) {
+  if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT || w == 0 || h == 0) return;
+
+  uint32_t x_end = (w <= SSD1306_WIDTH - x) ? x + w : SSD1306_WIDTH;
+  uint32_t y_end = (h <= SSD1306_HEIGHT - y) ? y + h : SSD1306_HEIGHT;
+  uint8_t bits = (color == White) ? 0xFF : 0x00;
+
+  for (uint32_t page = y / 8; page * 8 < y_end; page++) {
+    uint32_t top = (y > page * 8) ? y - page * 8 : 0;
+    uint32_t bottom = (y_end < page * 8 + 8) ? y_end - page * 8 : 8;
+    uint8_t mask = (uint8_t)((0xFFu << top) & (0xFFu >> (8 - bottom)));
+    for (uint32_t cx = x; cx < x_end; cx++)
+      ssd1306_WriteMasked(page, cx, mask, bits);
+  }
+}
+
+// Draw horizontal span
+void ssd1306_DrawHLine(uint8_t x, uint8_t y, uint8_t w, SSD1306_COLOR color) {
+  ssd1306_FillRect(x, y, w, 1, color);
+}
+
+// Draw vertical span
+void ssd1306_DrawVLine(uint8_t x, uint8_t y, uint8_t h, SSD1306_COLOR color) {
+  ssd1306_FillRect(x, y, 1, h, color);
+}
+
 // Draw 1 char to the screen buffer
 // ch       => char om weg te schrijven
 // Font     => Font waarmee we gaan schrijven
@@ -298,19 +485,22 @@ char ssd1306_DrawChar(char ch, FontDef Font, SSD1306_COLOR color) {
     return 0;
   }
 
-  // Use the font to write
+  // Use the font to write：行扫描字模先转为列字节，再整字节写入显存
+  uint8_t cols[SSD1306_FONT_MAX_PAGES * SSD1306_FONT_MAX_WIDTH] = {0};
+  if (Font.FontWidth > SSD1306_FONT_MAX_WIDTH ||
+      Font.FontHeight > SSD1306_FONT_MAX_PAGES * 8) {
+    return 0;
+  }
   for (i = 0; i < Font.FontHeight; i++) {
     b = Font.data[(ch - ch_min) * Font.FontHeight + i];
     for (j = 0; j < Font.FontWidth; j++) {
       if ((b << j) & 0x8000) {
-        ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i),
-                          (SSD1306_COLOR)color);
-      } else {
-        ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i),
-                          (SSD1306_COLOR)!color);
+        cols[(i / 8) * Font.FontWidth + j] |= 1 << (i % 8);
       }
     }
   }
+  ssd1306_DrawColumnBytes(SSD1306.CurrentX, SSD1306.CurrentY, Font.FontWidth,
+                          Font.FontHeight, cols, color);
 
   // The current space is now taken
   SSD1306.CurrentX += Font.FontWidth;
@@ -431,10 +621,15 @@ void ssd1306_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r,
 // Draw rectangle
 void ssd1306_DrawRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
                            SSD1306_COLOR color) {
-  ssd1306_DrawLine(x1, y1, x2, y1, color);
-  ssd1306_DrawLine(x2, y1, x2, y2, color);
-  ssd1306_DrawLine(x2, y2, x1, y2, color);
-  ssd1306_DrawLine(x1, y2, x1, y1, color);
+  uint8_t left = (x1 < x2) ? x1 : x2;
+  uint8_t top = (y1 < y2) ? y1 : y2;
+  uint8_t w = (uint8_t)((x1 < x2 ? x2 - x1 : x1 - x2) + 1);
+  uint8_t h = (uint8_t)((y1 < y2 ? y2 - y1 : y1 - y2) + 1);
+
+  ssd1306_DrawHLine(left, y1, w, color);
+  ssd1306_DrawHLine(left, y2, w, color);
+  ssd1306_DrawVLine(x1, top, h, color);
+  ssd1306_DrawVLine(x2, top, h, color);
 }
 
 void ssd1306_DrawBitmap(const uint8_t* bitmap, uint32_t size) {
@@ -66,7 +66,8 @@ typedef struct {
 bool ssd1306_Init(void);  // 返回 true 表示初始化成功，false 表示失败
 void ssd1306_Fill(SSD1306_COLOR color);
 void ssd1306_SetCursor(uint8_t x, uint8_t y);
-void ssd1306_UpdateScreen(void);
+void ssd1306_UpdateScreen(void);  // 只发送绘制后内容有变化的页/列窗口
+void ssd1306_Invalidate(void);    // 标记整屏需要重新发送（面板内容未知时）
 
 char ssd1306_DrawChar(char ch, FontDef Font, SSD1306_COLOR color);
 char ssd1306_DrawString(char* str, FontDef Font, SSD1306_COLOR color);
@@ -74,6 +75,11 @@ void ssd1306_DrawString16(uint8_t x, uint8_t y, const char* str,
                           SSD1306_COLOR color);
 
 void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color);
+// 整字节光栅图元：超出屏幕的部分被裁剪
+void ssd1306_DrawHLine(uint8_t x, uint8_t y, uint8_t w, SSD1306_COLOR color);
+void ssd1306_DrawVLine(uint8_t x, uint8_t y, uint8_t h, SSD1306_COLOR color);
+void ssd1306_FillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      SSD1306_COLOR color);
 void ssd1306_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
                       SSD1306_COLOR color);
 void ssd1306_DrawPolyline(const SSD1306_VERTEX* par_vertex, uint16_t par_size,
@@ -85,6 +91,10 @@ void ssd1306_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r,
 void ssd1306_DrawBitmap(const uint8_t* bitmap, uint32_t size);
 void ssd1306_DrawRegion(uint8_t x, uint8_t y, uint8_t w, const uint8_t* data,
                         uint32_t size);
+// 按 SSD1306 页格式（每字节一列 8 行，bit0 在上）整字节写入 w x h 矩形，
+// data 为 ceil(h / 8) 行、每行 w 字节；y 可不按页对齐
+void ssd1306_DrawColumnBytes(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                             const uint8_t* data, SSD1306_COLOR color);
 
 /**
  * @brief Sets the contrast of the display.
@@ -4,25 +4,51 @@
 #include "ssd1306.h"
 #include "ssd1306_fonts.h"
 
-/* Helper to get UTF-8 character length */
-static int GetUtf8CharLength(const char* target) {
-  unsigned char c = (unsigned char)target[0];
-  if (c <= 0x7F) return 1;
-  if ((c >= 0xC2 && c <= 0xDF)) return 2;
-  if ((c >= 0xE0 && c <= 0xEF)) return 3;
-  if ((c >= 0xF0 && c <= 0xF7)) return 4;
-  return 1;
+/* Decode one UTF-8 character, return its byte length (invalid -> 1) */
+static int DecodeUtf8Char(const char* target, uint32_t* code) {
+  const unsigned char* s = (const unsigned char*)target;
+  int len;
+
+  if (s[0] <= 0x7F) {
+    *code = s[0];
+    return 1;
+  }
+  if (s[0] >= 0xC2 && s[0] <= 0xDF) {
+    len = 2;
+    *code = s[0] & 0x1F;
+  } else if (s[0] >= 0xE0 && s[0] <= 0xEF) {
+    len = 3;
+    *code = s[0] & 0x0F;
+  } else if (s[0] >= 0xF0 && s[0] <= 0xF7) {
+    len = 4;
+    *code = s[0] & 0x07;
+  } else {
+    *code = s[0];
+    return 1;
+  }
+  for (int i = 1; i < len; i++) {
+    if ((s[i] & 0xC0) != 0x80) {  // 截断或非法序列，按单字节跳过
+      *code = s[0];
+      return 1;
+    }
+    *code = (*code << 6) | (s[i] & 0x3F);
+  }
+  return len;
 }
 
-/* Find index in the font array */
-static int FindFontIndex(const char* target, int len) {
-  int i;
-  int count = 162;  // Based on the array size in FontDotMatrix16.c
+/* Find index in the font array (code table is sorted, binary search) */
+static int FindFontIndex(uint32_t code) {
+  int lo = 0;
+  int hi = (int)g_font_dot_matrix_16_count - 1;
 
-  for (i = 0; i < count; i++) {
-    const char* idx_str = g_font_dot_matrix_16_index[i];
-    if (strncmp(idx_str, target, len) == 0 && idx_str[len] == '\0') {
-      return i;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    uint32_t c = g_font_dot_matrix_16_code[mid];
+    if (c == code) return mid;
+    if (c < code) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
     }
   }
   return -1;
@@ -35,7 +61,8 @@ void ssd1306_DrawString16(uint8_t x, uint8_t y, const char* str,
   const char* p = str;
 
   while (*p) {
-    int len = GetUtf8CharLength(p);
+    uint32_t code;
+    int len = DecodeUtf8Char(p, &code);
 
     if (len == 1) {
       // ASCII character
@@ -44,29 +71,14 @@ void ssd1306_DrawString16(uint8_t x, uint8_t y, const char* str,
       ssd1306_DrawChar(*p, Font_7x10, color);
       curr_x += 7;  // Font width
     } else {
-      int index = FindFontIndex(p, len);
+      int index = FindFontIndex(code);
 
       if (index >= 0) {
-        // Draw 16x16 bitmap
-        const char* bitmap = g_font_dot_matrix_16[index];
-        for (int i = 0; i < 16; i++) {
-          uint8_t byte = bitmap[i];
-          for (int b = 0; b < 8; b++) {
-            ssd1306_DrawPixel(
-                curr_x + i, curr_y + b,
-                (byte & (1 << b)) ? color : (SSD1306_COLOR)!color);
-          }
-          byte = bitmap[i + 16];
-          for (int b = 0; b < 8; b++) {
-            ssd1306_DrawPixel(
-                curr_x + i, curr_y + 8 + b,
-                (byte & (1 << b)) ? color : (SSD1306_COLOR)!color);
-          }
-        }
-        curr_x += 16;
-      } else {
-        curr_x += 16;
+        // Draw 16x16 bitmap：字模即两页列字节，整字节写入显存
+        ssd1306_DrawColumnBytes(curr_x, curr_y, 16, 16,
+                                g_font_dot_matrix_16[index], color);
       }
+      curr_x += 16;
     }
 
     p += len;
@@ -26,12 +26,81 @@
 #include "gpio.h"
 #include "hal_gpio.h"
 #include "pinctrl.h"
+#include "securec.h"
 #include "soc_osal.h"
+#include "tcxo.h"
+
+#define TCRT5000_BARRIER() __sync_synchronize()
+#define TCRT5000_READ_RETRY 4  // 读者遇到写入中的槽位时的重试次数
 
 // ADC数据存储（使用自动扫描模式）
 uint32_t g_tcrt5000_adc_data[3] = {
     0};  // 存储左、中、右三个传感器的ADC电压值（mV）
 
+/*
+ * 标定数据交接
+ * - 唯一写者为 tcrt5000_set_profile 的调用者（初始化 / 控制线程），
+ *   写入带序号的槽位
+ * - 采集方每组开始前检查序号，有新数据时整份拷入私有副本并重置阈值；
+ *   g_profile 与 g_active_threshold 只由采集方修改，采集过程中不会
+ *   读到写了一半的标定数据
+ */
+typedef struct {
+  volatile uint32_t lock_seq;  // 奇数表示正在写入
+  Tcrt5000Profile profile;
+} Tcrt5000ProfileSlot;
+
+static Tcrt5000ProfileSlot g_profile_slot;
+static Tcrt5000Profile g_profile;   // 采集方正在使用的标定数据
+static uint32_t g_profile_seq = 0;  // 采集方已加载的槽位序号
+
+// 当前生效的判定阈值：白线状态下为 trigger，黑线状态下为 release。
+// 在采样回调中切换，读取状态时只需一次比较
+static uint32_t g_active_threshold[TCRT5000_CHANNEL_NUM] = {
+    TCRT5000_LEFT_THRESHOLD, TCRT5000_MIDDLE_THRESHOLD,
+    TCRT5000_RIGHT_THRESHOLD};
+
+static const uint8_t g_adc_channels[TCRT5000_CHANNEL_NUM] = {
+    TCRT5000_LEFT_ADC_CHANNEL, TCRT5000_MIDDLE_ADC_CHANNEL,
+    TCRT5000_RIGHT_ADC_CHANNEL};
+
+/*
+ * 采样组双缓冲
+ * - 唯一写者为采集任务（未启动后台采集时为 tcrt5000_adc_sample 的调用者），
+ *   只写未发布的槽位，写完后切换 g_pub_idx
+ * - 槽位带序号，读者读前后序号一致即为同一组；写者优先级低于控制线程，
+ *   读者从不等待写者
+ */
+typedef struct {
+  volatile uint32_t lock_seq;  // 奇数表示正在写入
+  Tcrt5000SampleSet set;
+} Tcrt5000Slot;
+
+static Tcrt5000Slot g_slots[2];
+static volatile uint32_t g_pub_idx = 0;  // 已发布的槽位
+static uint32_t g_set_seq = 0;           // 组序号（写者私有）
+
+// 过采样累加，仅在一组采集过程中由 ADC 回调更新
+static bool g_accumulating = false;
+static uint32_t g_acc_sum[TCRT5000_CHANNEL_NUM];
+static uint32_t g_acc_cnt[TCRT5000_CHANNEL_NUM];
+
+static volatile bool g_scanning = false;    // 后台采集是否运行
+static volatile bool g_scan_alive = false;  // 采集任务是否尚未退出
+static uint32_t g_scan_period_ms = 1;
+static uint8_t g_oversample = 1;
+
+/**
+ * @brief 根据新读数更新滞回阈值
+ * @param idx 传感器下标
+ * @param mv 新读数
+ */
+static void tcrt5000_update_threshold(int idx, uint32_t mv) {
+  g_active_threshold[idx] = (mv >= g_active_threshold[idx])
+                                ? g_profile.release_mv[idx]
+                                : g_profile.trigger_mv[idx];
+}
+
 /**
  * @brief ADC自动扫描回调函数
  * @param channel ADC通道
@@ -46,12 +115,25 @@ void tcrt5000_adc_callback(uint8_t channel, uint32_t* buffer, uint32_t length,
     // 通道2 -> 左侧传感器 (索引0)
     // 通道1 -> 中间传感器 (索引1)
     // 通道0 -> 右侧传感器 (索引2)
+    int idx = -1;
     if (channel == TCRT5000_LEFT_ADC_CHANNEL) {
-      g_tcrt5000_adc_data[0] = buffer[0];
+      idx = 0;
     } else if (channel == TCRT5000_MIDDLE_ADC_CHANNEL) {
-      g_tcrt5000_adc_data[1] = buffer[0];
+      idx = 1;
     } else if (channel == TCRT5000_RIGHT_ADC_CHANNEL) {
-      g_tcrt5000_adc_data[2] = buffer[0];
+      idx = 2;
+    }
+    if (idx >= 0) {
+      // FIFO 中本通道的样本全部使用，不再只取第一个
+      uint32_t sum = 0;
+      for (uint32_t i = 0; i < length; i++) sum += buffer[i];
+      if (g_accumulating) {
+        g_acc_sum[idx] += sum;
+        g_acc_cnt[idx] += length;
+      } else {
+        g_tcrt5000_adc_data[idx] = sum / length;
+        tcrt5000_update_threshold(idx, g_tcrt5000_adc_data[idx]);
+      }
     }
   }
   *next = false;  // 停止扫描
@@ -83,7 +165,7 @@ void tcrt5000_init(void) {
  * @return 0: 检测到黑线, 1: 未检测到黑线
  */
 unsigned int tcrt5000_get_left(void) {
-  return (g_tcrt5000_adc_data[0] >= TCRT5000_LEFT_THRESHOLD)
+  return (g_tcrt5000_adc_data[0] >= g_active_threshold[0])
              ? TCRT5000_ON_BLACK
              : TCRT5000_ON_WHITE;
 }
@@ -93,7 +175,7 @@ unsigned int tcrt5000_get_left(void) {
  * @return 0: 检测到黑线, 1: 未检测到黑线
  */
 unsigned int tcrt5000_get_middle(void) {
-  return (g_tcrt5000_adc_data[1] >= TCRT5000_MIDDLE_THRESHOLD)
+  return (g_tcrt5000_adc_data[1] >= g_active_threshold[1])
              ? TCRT5000_ON_BLACK
              : TCRT5000_ON_WHITE;
 }
@@ -103,16 +185,102 @@ unsigned int tcrt5000_get_middle(void) {
  * @return 0: 检测到黑线, 1: 未检测到黑线
  */
 unsigned int tcrt5000_get_right(void) {
-  return (g_tcrt5000_adc_data[2] >= TCRT5000_RIGHT_THRESHOLD)
+  return (g_tcrt5000_adc_data[2] >= g_active_threshold[2])
              ? TCRT5000_ON_BLACK
              : TCRT5000_ON_WHITE;
 }
 
 /**
- * @brief 初始化TCRT5000 ADC模式
+ * @brief 运行时替换标定数据
+ * @param profile 标定数据，NULL 表示恢复默认阈值
+ * @return 无
+ */
+void tcrt5000_set_profile(const Tcrt5000Profile* profile) {
+  static const uint16_t default_threshold[TCRT5000_CHANNEL_NUM] = {
+      TCRT5000_LEFT_THRESHOLD, TCRT5000_MIDDLE_THRESHOLD,
+      TCRT5000_RIGHT_THRESHOLD};
+  Tcrt5000ProfileSlot* slot = &g_profile_slot;
+
+  slot->lock_seq++;  // 奇数：写入中
+  TCRT5000_BARRIER();
+  if (profile != NULL) {
+    slot->profile = *profile;
+  } else {
+    // 默认阈值不带滞回，与原固定阈值行为一致
+    (void)memset_s(&slot->profile, sizeof(slot->profile), 0,
+                   sizeof(slot->profile));
+    for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+      slot->profile.trigger_mv[i] = default_threshold[i];
+      slot->profile.release_mv[i] = default_threshold[i];
+    }
+  }
+  TCRT5000_BARRIER();
+  slot->lock_seq++;  // 偶数：写入完成，采集方下一组开始时生效
+}
+
+/**
+ * @brief 从槽位读出一份完整的标定数据
+ * @param out 输出标定数据
+ * @param seq 输出读到的槽位序号
+ * @return true 读取成功；false 写者持续写入，未能读到完整数据
+ */
+static bool tcrt5000_read_profile(Tcrt5000Profile* out, uint32_t* seq) {
+  const Tcrt5000ProfileSlot* slot = &g_profile_slot;
+
+  for (int i = 0; i < TCRT5000_READ_RETRY; i++) {
+    uint32_t begin = slot->lock_seq;
+    TCRT5000_BARRIER();
+    if (begin & 1u) continue;
+    Tcrt5000Profile copy = slot->profile;
+    TCRT5000_BARRIER();
+    if (slot->lock_seq != begin) continue;
+    *out = copy;
+    *seq = begin;
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief 加载新标定数据并重置滞回阈值（仅采集方在一组开始前调用）
+ * @note 未能读到完整数据时沿用当前数据，下一组再试
+ */
+static void tcrt5000_load_profile(void) {
+  if (g_profile_slot.lock_seq == g_profile_seq) return;
+
+  Tcrt5000Profile profile;
+  uint32_t seq;
+  if (!tcrt5000_read_profile(&profile, &seq)) return;
+  g_profile = profile;
+  g_profile_seq = seq;
+  for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++)
+    g_active_threshold[i] = g_profile.trigger_mv[i];
+}
+
+/**
+ * @brief 获取最近一次设置的标定数据
+ * @param profile 输出标定数据
+ * @return 无
+ */
+void tcrt5000_get_profile(Tcrt5000Profile* profile) {
+  uint32_t seq;
+  if (profile != NULL) (void)tcrt5000_read_profile(profile, &seq);
+}
+
+/**
+ * @brief 初始化TCRT5000 ADC模式（使用默认阈值）
  * @return 无
  */
-void tcrt5000_adc_init(void) {
+void tcrt5000_adc_init(void) { tcrt5000_adc_init_with_profile(NULL); }
+
+/**
+ * @brief 初始化TCRT5000 ADC模式并加载标定数据
+ * @param profile 标定数据，NULL 表示使用默认阈值
+ * @return 无
+ */
+void tcrt5000_adc_init_with_profile(const Tcrt5000Profile* profile) {
+  tcrt5000_set_profile(profile);
+
   // 初始化ADC
   uapi_adc_init(ADC_CLOCK_500KHZ);
   // 使能ADC电源
@@ -129,6 +297,130 @@ void tcrt5000_adc_init(void) {
   uapi_pin_set_pull(TCRT5000_RIGHT_GPIO, PIN_PULL_TYPE_DISABLE);
 }
 
+/**
+ * @brief 将本组累加结果平均后发布到未发布的槽位（仅写者调用）
+ */
+static void tcrt5000_publish(void) {
+  uint32_t idx = g_pub_idx ^ 1u;
+  Tcrt5000Slot* slot = &g_slots[idx];
+
+  slot->lock_seq++;  // 奇数：写入中
+  TCRT5000_BARRIER();
+  for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+    // 本组没有拿到该通道的样本时沿用上一组
+    if (g_acc_cnt[i] > 0) {
+      g_tcrt5000_adc_data[i] = g_acc_sum[i] / g_acc_cnt[i];
+      tcrt5000_update_threshold(i, g_tcrt5000_adc_data[i]);
+    }
+    slot->set.mv[i] = g_tcrt5000_adc_data[i];
+    slot->set.state[i] = (g_tcrt5000_adc_data[i] >= g_active_threshold[i])
+                             ? TCRT5000_ON_BLACK
+                             : TCRT5000_ON_WHITE;
+  }
+  slot->set.timestamp_us = uapi_tcxo_get_us();
+  slot->set.seq = ++g_set_seq;
+  TCRT5000_BARRIER();
+  slot->lock_seq++;  // 偶数：写入完成
+  TCRT5000_BARRIER();
+  g_pub_idx = idx;
+}
+
+/**
+ * @brief 采集一组三路数据：各通道轮流转换 oversample 次后平均并发布
+ * @note 当前 ADC HAL 只在关闭通道时同步取出 FIFO 并回调，不支持持续扫描
+ *       回调，因此每次转换仍需一次使能 / 关闭；使能后等待转换完成，
+ *       保证每次回调拿到的是新样本
+ */
+static void tcrt5000_acquire(uint8_t oversample) {
+  adc_scan_config_t config = {.type = 0, .freq = 1};
+
+  tcrt5000_load_profile();
+  for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+    g_acc_sum[i] = 0;
+    g_acc_cnt[i] = 0;
+  }
+  g_accumulating = true;
+  for (uint8_t n = 0; n < oversample; n++) {
+    for (int i = 0; i < TCRT5000_CHANNEL_NUM; i++) {
+      uapi_adc_auto_scan_ch_enable(g_adc_channels[i], config,
+                                   tcrt5000_adc_callback);
+      uapi_tcxo_delay_us(TCRT5000_CONVERT_US);
+      uapi_adc_auto_scan_ch_disable(g_adc_channels[i]);
+    }
+  }
+  g_accumulating = false;
+  tcrt5000_publish();
+}
+
+/**
+ * @brief 触发一次三路ADC采样（结果通过回调写入缓存）
+ * @return 无
+ * @note 后台采集运行时直接返回，数据由采集任务持续更新
+ */
+void tcrt5000_adc_sample(void) {
+  if (g_scanning) return;
+  tcrt5000_acquire(1);
+}
+
+/**
+ * @brief 后台采集任务
+ */
+static void* tcrt5000_scan_task(const char* arg) {
+  (void)arg;
+  while (g_scanning) {
+    tcrt5000_acquire(g_oversample);
+    osal_msleep(g_scan_period_ms);
+  }
+  g_scan_alive = false;
+  return NULL;
+}
+
+int tcrt5000_scan_start(uint32_t period_ms, uint8_t oversample) {
+  if (g_scanning) return 0;
+  if (g_scan_alive) return -1;  // 上一次停止的任务尚未退出
+
+  g_scan_period_ms = period_ms > 0 ? period_ms : 1;
+  if (oversample == 0) oversample = 1;
+  g_oversample = oversample > TCRT5000_MAX_OVERSAMPLE ? TCRT5000_MAX_OVERSAMPLE
+                                                      : oversample;
+  g_scanning = true;
+  g_scan_alive = true;
+
+  osal_task* task =
+      osal_kthread_create((osal_kthread_handler)tcrt5000_scan_task, NULL,
+                          "tcrt5000_scan", TCRT5000_SCAN_STACK_SIZE);
+  if (task == NULL) {
+    g_scanning = false;
+    g_scan_alive = false;
+    printf("TCRT5000：采集任务创建失败\r\n");
+    return -1;
+  }
+  osal_kthread_set_priority(task, TCRT5000_SCAN_PRIORITY);
+  printf("TCRT5000：后台采集已启动，周期 %ums，过采样 %u 次\r\n",
+         (unsigned)g_scan_period_ms, (unsigned)g_oversample);
+  return 0;
+}
+
+void tcrt5000_scan_stop(void) { g_scanning = false; }
+
+bool tcrt5000_get_sample_set(Tcrt5000SampleSet* out) {
+  if (out == NULL) return false;
+
+  for (int i = 0; i < TCRT5000_READ_RETRY; i++) {
+    const Tcrt5000Slot* slot = &g_slots[g_pub_idx];
+    uint32_t seq = slot->lock_seq;
+    TCRT5000_BARRIER();
+    if (seq & 1u) continue;
+    Tcrt5000SampleSet copy = slot->set;
+    TCRT5000_BARRIER();
+    if (slot->lock_seq != seq) continue;
+    if (copy.seq == 0) return false;  // 尚未发布过
+    *out = copy;
+    return true;
+  }
+  return false;
+}
+
 /**
  * @brief 获取左侧传感器ADC电压值
  * @return ADC电压值 (mV)
@@ -20,6 +20,7 @@
 #ifndef __BSP_TCRT5000_H__
 #define __BSP_TCRT5000_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "gpio.h"
@@ -40,12 +41,43 @@
 #define TCRT5000_ON_BLACK 0  // 检测到黑线
 #define TCRT5000_ON_WHITE 1  // 检测到白色/无黑线
 
-// ADC阈值定义（mV）
+// 默认ADC阈值定义（mV），未加载标定数据时使用
 // ADC值 >= 阈值表示检测到黑线，ADC值 < 阈值表示检测到白线
 #define TCRT5000_LEFT_THRESHOLD 2000    // 左侧传感器阈值
 #define TCRT5000_MIDDLE_THRESHOLD 1900  // 中间传感器阈值
 #define TCRT5000_RIGHT_THRESHOLD 1900   // 右侧传感器阈值
 
+#define TCRT5000_CHANNEL_NUM 3  // 传感器数量（下标 0=左 1=中 2=右）
+
+// 后台采集参数
+#define TCRT5000_MAX_OVERSAMPLE 16     // 每路每组最大过采样次数
+#define TCRT5000_CONVERT_US 50         // 通道使能后等待转换完成的时间 (us)
+#define TCRT5000_SCAN_STACK_SIZE 2048  // 采集任务栈大小
+#define TCRT5000_SCAN_PRIORITY 26      // 采集任务优先级（低于控制任务）
+
+/**
+ * @brief 一组三路采样（同一次采集产生，左/中/右一致）
+ */
+typedef struct {
+  uint32_t mv[TCRT5000_CHANNEL_NUM];    // 过采样平均后的电压 (mV)
+  uint8_t state[TCRT5000_CHANNEL_NUM];  // TCRT5000_ON_BLACK / TCRT5000_ON_WHITE
+  uint64_t timestamp_us;                // 本组采集完成时刻 (TCXO us)
+  uint32_t seq;                         // 组序号，每发布一组加 1
+} Tcrt5000SampleSet;
+
+/**
+ * @brief 传感器标定数据（mV）
+ * @note 读数 >= trigger_mv 由白变黑，读数 < release_mv 由黑变白，
+ *       两者之差即滞回宽度
+ */
+typedef struct {
+  uint16_t white_mv[TCRT5000_CHANNEL_NUM];    // 白底读数（标定最小值）
+  uint16_t black_mv[TCRT5000_CHANNEL_NUM];    // 黑线读数（标定最大值）
+  uint16_t noise_mv[TCRT5000_CHANNEL_NUM];    // 静止时读数波动
+  uint16_t trigger_mv[TCRT5000_CHANNEL_NUM];  // 判定为黑线的阈值
+  uint16_t release_mv[TCRT5000_CHANNEL_NUM];  // 判定为白线的阈值
+} Tcrt5000Profile;
+
 // ADC数据存储（使用自动扫描模式）
 extern uint32_t
     g_tcrt5000_adc_data[3];  // 存储左、中、右三个传感器的ADC电压值（mV）
@@ -85,11 +117,61 @@ unsigned int tcrt5000_get_middle(void);
 unsigned int tcrt5000_get_right(void);
 
 /**
- * @brief 初始化TCRT5000 ADC模式
+ * @brief 初始化TCRT5000 ADC模式（使用默认阈值）
  * @return 无
  */
 void tcrt5000_adc_init(void);
 
+/**
+ * @brief 初始化TCRT5000 ADC模式并加载标定数据
+ * @param profile 标定数据，NULL 表示使用默认阈值
+ * @return 无
+ */
+void tcrt5000_adc_init_with_profile(const Tcrt5000Profile* profile);
+
+/**
+ * @brief 运行时替换标定数据
+ * @param profile 标定数据，NULL 表示恢复默认阈值
+ * @return 无
+ * @note 只允许一个线程调用；下一组采集开始时生效
+ */
+void tcrt5000_set_profile(const Tcrt5000Profile* profile);
+
+/**
+ * @brief 获取最近一次设置的标定数据
+ * @param profile 输出标定数据
+ * @return 无
+ */
+void tcrt5000_get_profile(Tcrt5000Profile* profile);
+
+/**
+ * @brief 触发一次三路ADC采样（结果通过回调写入缓存）
+ * @return 无
+ * @note 后台采集运行时直接返回，数据由采集任务持续更新
+ */
+void tcrt5000_adc_sample(void);
+
+/**
+ * @brief 启动后台连续采集
+ * @param period_ms 两组采集之间的间隔 (ms)
+ * @param oversample 每路每组的采样次数，超过 TCRT5000_MAX_OVERSAMPLE 时截断
+ * @return 0 成功，-1 失败
+ * @note 低优先级任务轮流转换三路通道，每路平均 oversample 次后
+ *       整组发布到双缓冲，控制线程读取时不再访问 ADC
+ */
+int tcrt5000_scan_start(uint32_t period_ms, uint8_t oversample);
+
+/**
+ * @brief 停止后台连续采集（采集任务在当前一组完成后退出）
+ */
+void tcrt5000_scan_stop(void);
+
+/**
+ * @brief 读取最新一组采样（O(1)，不阻塞）
+ * @return true 读到一致的一组，false 尚无数据或写者正在更新
+ */
+bool tcrt5000_get_sample_set(Tcrt5000SampleSet* out);
+
 /**
  * @brief 获取左侧传感器ADC电压值
  * @return ADC电压值 (mV)
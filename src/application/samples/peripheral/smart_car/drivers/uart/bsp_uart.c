@@ -1,6 +1,8 @@
 /**
  * @file bsp_uart.c
  * @brief UART串口驱动实现 - 用于智能小车串口命令接收
+ * @details 环形缓冲使用自由递增的读/写索引：写索引只由接收中断修改，
+ *          读索引只由解析任务修改，双方都不加锁。缓冲满时丢弃新数据并计数
  */
 
 #include "bsp_uart.h"
@@ -10,9 +12,12 @@
 #include "soc_osal.h"
 #include "uart.h"
 
+#if (BSP_UART_RING_SIZE & (BSP_UART_RING_SIZE - 1)) != 0
+#error "BSP_UART_RING_SIZE must be a power of two"
+#endif
+
 /* UART配置参数 */
-#define UART_BAUDRATE 9600
-#define UART_RX_BUFFER_SIZE 64
+#define UART_RX_BUFFER_SIZE 128  // 驱动接收缓冲，满或线路空闲时回调一次
 
 /* UART引脚配置 */
 #define UART_TXD_PIN 8
@@ -23,27 +28,44 @@
 /* UART总线ID */
 #define UART_BUS_ID 2
 
-/* 接收缓冲区 */
+#define UART_RING_MASK (BSP_UART_RING_SIZE - 1)
+
+/* 驱动接收缓冲区 */
 static uint8_t g_uart_rx_buffer[UART_RX_BUFFER_SIZE] = {0};
 
-/* 回调函数指针 */
-static uart_data_callback_t g_data_callback = NULL;
+/* 环形缓冲 */
+static uint8_t g_ring[BSP_UART_RING_SIZE];
+static volatile uint32_t g_head = 0;  /* 写索引（接收中断） */
+static volatile uint32_t g_tail = 0;  /* 读索引（解析任务） */
+
+static osal_semaphore g_rx_sem;  /* 有新数据时释放 */
+static BspUartStats g_stats = {0};
 
 /**
- * @brief UART接收中断回调函数
+ * @brief UART接收中断回调函数：拷入环形缓冲并唤醒解析任务
  * @param buffer 接收到的数据指针
  * @param length 数据长度
  * @param error 错误标志
  */
 static void uart_rx_interrupt_handler(const void* buffer, uint16_t length,
                                       bool error) {
-  unused(error);
-
-  if (buffer == NULL || length == 0 || g_data_callback == NULL) {
-    return;
-  }
-
-  g_data_callback((const uint8_t*)buffer, length);
+  g_stats.rx_callbacks++;
+  if (error) g_stats.rx_errors++;
+  if (buffer == NULL || length == 0) return;
+
+  const uint8_t* data = (const uint8_t*)buffer;
+  uint32_t head = g_head;
+  uint32_t space = BSP_UART_RING_SIZE - (head - g_tail);
+  uint16_t n = length > space ? (uint16_t)space : length;
+
+  for (uint16_t i = 0; i < n; i++)
+    g_ring[(head + i) & UART_RING_MASK] = data[i];
+  __sync_synchronize();  // 数据先于写索引可见
+  g_head = head + n;
+
+  g_stats.rx_bytes += n;
+  g_stats.rx_dropped += length - n;
+  osal_sem_up(&g_rx_sem);
 }
 
 /**
@@ -60,8 +82,8 @@ static void uart_init_pin(void) {
 /**
  * @brief 初始化UART配置
  */
-static void uart_init_config(void) {
-  uart_attr_t attr = {.baud_rate = UART_BAUDRATE,
+static int uart_init_config(uint32_t baud_rate) {
+  uart_attr_t attr = {.baud_rate = baud_rate,
                       .data_bits = UART_DATA_BIT_8,
                       .stop_bits = UART_STOP_BIT_1,
                       .parity = UART_PARITY_NONE};
@@ -75,35 +97,70 @@ static void uart_init_config(void) {
                                         .rx_buffer_size = UART_RX_BUFFER_SIZE};
 
   uapi_uart_deinit(UART_BUS_ID);
-  uapi_uart_init(UART_BUS_ID, &pin_config, &attr, NULL, &buffer_config);
+  if (uapi_uart_init(UART_BUS_ID, &pin_config, &attr, NULL, &buffer_config) !=
+      ERRCODE_SUCC)
+    return -1;
+  return 0;
 }
 
 /**
  * @brief 注册UART接收回调
+ * @note 按缓冲满或线路空闲触发，一帧只回调一次，不再逐字节回调
  */
-static void uart_register_rx_callback(void) {
-  uapi_uart_register_rx_callback(
-      UART_BUS_ID, UART_RX_CONDITION_FULL_OR_SUFFICIENT_DATA_OR_IDLE, 1,
-      uart_rx_interrupt_handler);
+static int uart_register_rx_callback(void) {
+  if (uapi_uart_register_rx_callback(
+          UART_BUS_ID, UART_RX_CONDITION_FULL_OR_IDLE, UART_RX_BUFFER_SIZE,
+          uart_rx_interrupt_handler) != ERRCODE_SUCC)
+    return -1;
+  return 0;
 }
 
-int bsp_uart_init(uart_data_callback_t callback) {
-  if (callback == NULL) {
+int bsp_uart_init(uint32_t baud_rate) {
+  if (baud_rate == 0) {
     return -1;
   }
 
-  g_data_callback = callback;
+  g_head = 0;
+  g_tail = 0;
+  if (osal_sem_binary_sem_init(&g_rx_sem, 0) != OSAL_SUCCESS) {
+    printf("BSP_UART: 信号量初始化失败\r\n");
+    return -1;
+  }
 
-  uart_init_pin();              // 初始化引脚
-  uart_init_config();           // 初始化UART配置
-  uart_register_rx_callback();  // 注册接收回调
+  uart_init_pin();  // 初始化引脚
+  if (uart_init_config(baud_rate) != 0 || uart_register_rx_callback() != 0) {
+    printf("BSP_UART: UART%d 初始化失败\r\n", UART_BUS_ID);
+    osal_sem_destroy(&g_rx_sem);
+    return -1;
+  }
 
-  printf("BSP_UART: UART%d initialized, baudrate=%d\r\n", UART_BUS_ID,
-         UART_BAUDRATE);
+  printf("BSP_UART: UART%d initialized, baudrate=%u\r\n", UART_BUS_ID,
+         (unsigned)baud_rate);
 
   return 0;
 }
 
+bool bsp_uart_wait(uint32_t timeout_ms) {
+  if (g_head != g_tail) return true;
+  (void)osal_sem_down_timeout(&g_rx_sem, timeout_ms);
+  return g_head != g_tail;
+}
+
+uint16_t bsp_uart_read(uint8_t* buf, uint16_t size) {
+  if (buf == NULL || size == 0) return 0;
+
+  uint32_t tail = g_tail;
+  uint32_t avail = g_head - tail;
+  __sync_synchronize();  // 先读写索引再读数据
+  uint16_t n = avail > size ? size : (uint16_t)avail;
+
+  for (uint16_t i = 0; i < n; i++)
+    buf[i] = g_ring[(tail + i) & UART_RING_MASK];
+  __sync_synchronize();  // 数据读完后再释放空间
+  g_tail = tail + n;
+  return n;
+}
+
 int bsp_uart_send(const uint8_t* data, uint16_t length) {
   if (data == NULL || length == 0) {
     return -1;
@@ -111,3 +168,7 @@ int bsp_uart_send(const uint8_t* data, uint16_t length) {
 
   return uapi_uart_write(UART_BUS_ID, data, length, 0);
 }
+
+void bsp_uart_get_stats(BspUartStats* out) {
+  if (out != NULL) *out = g_stats;
+}
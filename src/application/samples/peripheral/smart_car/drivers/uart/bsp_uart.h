@@ -1,6 +1,8 @@
 /**
  * @file bsp_uart.h
  * @brief UART串口驱动 - 用于智能小车串口命令接收
+ * @details 接收中断（缓冲满或线路空闲时触发）只把数据拷入无锁环形缓冲并
+ *          唤醒等待的任务，协议解析在任务上下文中通过 bsp_uart_read 取数据
  */
 
 #ifndef BSP_UART_H
@@ -9,20 +11,40 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#define BSP_UART_RING_SIZE 512  // 接收环形缓冲大小，必须为 2 的幂
+
 /**
- * @brief 数据接收回调函数类型
- * @param data 接收到的数据指针
- * @param length 数据长度
+ * @brief 接收统计
  */
-typedef void (*uart_data_callback_t)(const uint8_t* data, uint16_t length);
+typedef struct {
+  uint32_t rx_bytes;      // 写入环形缓冲的字节数
+  uint32_t rx_dropped;    // 环形缓冲满丢弃的字节数
+  uint32_t rx_errors;     // 线路错误（帧错误 / 溢出）次数
+  uint32_t rx_callbacks;  // 接收中断回调次数
+} BspUartStats;
 
 /**
  * @brief 初始化UART串口接收
- * @param callback 数据接收回调函数
+ * @param baud_rate 波特率（如 9600 / 115200，需与语音模块配置一致）
  * @return 0成功，非0失败
- * @note 波特率9600，引脚TX=8, RX=7，使用中断模式
+ * @note 引脚TX=8, RX=7
+ */
+int bsp_uart_init(uint32_t baud_rate);
+
+/**
+ * @brief 等待接收数据
+ * @param timeout_ms 超时时间 (ms)
+ * @return true 环形缓冲中有数据，false 超时
  */
-int bsp_uart_init(uart_data_callback_t callback);
+bool bsp_uart_wait(uint32_t timeout_ms);
+
+/**
+ * @brief 从环形缓冲取出数据（不阻塞，仅允许一个任务调用）
+ * @param buf 输出缓冲
+ * @param size 输出缓冲大小
+ * @return 实际取出的字节数
+ */
+uint16_t bsp_uart_read(uint8_t* buf, uint16_t size);
 
 /**
  * @brief UART发送数据
@@ -32,4 +54,9 @@ int bsp_uart_init(uart_data_callback_t callback);
  */
 int bsp_uart_send(const uint8_t* data, uint16_t length);
 
+/**
+ * @brief 获取接收统计
+ */
+void bsp_uart_get_stats(BspUartStats* out);
+
 #endif /* BSP_UART_H */
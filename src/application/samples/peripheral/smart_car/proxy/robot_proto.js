@@ -0,0 +1,201 @@
+// 上位机通信协议 v2 编解码（与固件 services/robot_proto.c 保持一致）
+// 帧格式（大端）: [B5][02][flags][00][seq u16][body_len u16][timestamp_us u32]
+//                [TLV...][CRC-16/CCITT-FALSE u16]，TLV = [type][len][value]
+// 旧版 5 字节帧 [type][cmd][m1][m2][ext] 解析时转换为等价的单个 TLV
+
+const MAGIC = 0xb5;
+const VERSION = 2;
+const HDR_LEN = 12;
+const CRC_LEN = 2;
+const LEGACY_LEN = 5;
+const FLAG_UPLINK = 0x01; // 小车 -> 上位机
+
+const TLV = {
+  DRIVE: 0x01, // 下行 [seq u8][left i8][right i8]
+  STATUS: 0x02, // 上行 [mode u8][distance_mm u16][ir_bits u8]
+  MODE: 0x03, // 下行 [mode u8]
+  PID: 0x04, // 下行 [param u8][value i16]
+  STREAM: 0x05, // 下行 [rate_hz u8]，0 关闭状态流
+  ACK: 0x06, // 下行 [seq u16] 确认已解码的状态流帧
+  LINE_ADC: 0x10, // 上行 [left u16][middle u16][right u16] (mV)
+  MOTOR: 0x11, // 上行 [duty_left i8][duty_right i8]
+  TELEM_BASE: 0x12, // 上行 [base_seq u16] 增量基准帧
+  TELEM_SAMPLE: 0x13, // 上行 [dt_ms u8][mask u16][字段...]
+  FLIGHT: 0x20, // 下行 [enable u8]
+  HEARTBEAT: 0xfe, // 双向，无 value
+};
+
+// 状态流样本字段掩码（与 services/telemetry_stream.h 一致，按位序排列）
+const TELEM_F = {
+  MODE: 0x0001, // u8
+  DIST: 0x0002, // u16 mm
+  IR: 0x0004, // u8 bits
+  ADC_L: 0x0008, // u16 mV（ADC_M / ADC_R 依次左移）
+  DUTY_L: 0x0040, // i8
+  DUTY_R: 0x0080, // i8
+  ERROR: 0x0100, // i16 误差 × 1000
+};
+
+// CRC-16/CCITT-FALSE（多项式 0x1021，初值 0xFFFF）
+const crc16 = (buf) => {
+  let crc = 0xffff;
+  for (const b of buf) {
+    crc ^= b << 8;
+    for (let i = 0; i < 8; i++) {
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+      crc &= 0xffff;
+    }
+  }
+  return crc;
+};
+
+// 组帧：tlvs 为 [{ type, value: Buffer | number[] }]
+const encode = (tlvs, { seq = 0, flags = 0, timestampUs = 0 } = {}) => {
+  const body = Buffer.concat(
+    tlvs.map(({ type, value = [] }) =>
+      Buffer.concat([Buffer.from([type, value.length]), Buffer.from(value)]),
+    ),
+  );
+  const frame = Buffer.alloc(HDR_LEN + body.length + CRC_LEN);
+  frame[0] = MAGIC;
+  frame[1] = VERSION;
+  frame[2] = flags;
+  frame.writeUInt16BE(seq & 0xffff, 4);
+  frame.writeUInt16BE(body.length, 6);
+  frame.writeUInt32BE(timestampUs >>> 0, 8);
+  body.copy(frame, HDR_LEN);
+  const crcOff = HDR_LEN + body.length;
+  frame.writeUInt16BE(crc16(frame.subarray(0, crcOff)), crcOff);
+  return frame;
+};
+
+// 旧版帧转换为 TLV value，未知类型返回 null
+const legacyValue = (msg) => {
+  switch (msg[0]) {
+    case TLV.DRIVE:
+    case TLV.PID:
+      return msg.subarray(1, 4);
+    case TLV.STATUS: {
+      // 旧版距离为 cm * 10，即 mm
+      const v = Buffer.alloc(4);
+      v[0] = msg[1];
+      v.writeUInt16BE(msg[2], 1);
+      v[3] = msg[4];
+      return v;
+    }
+    case TLV.MODE:
+    case TLV.FLIGHT:
+      return msg.subarray(1, 2);
+    case TLV.HEARTBEAT:
+      return Buffer.alloc(0);
+    default:
+      return null;
+  }
+};
+
+// 解析一帧，返回 { legacy, flags, seq, timestampUs, tlvs } 或 { error }
+const parse = (msg) => {
+  if (msg.length < 1) return { error: "short" };
+
+  if (msg[0] !== MAGIC) {
+    const value = msg.length === LEGACY_LEN ? legacyValue(msg) : null;
+    if (!value) return { error: "magic" };
+    return {
+      legacy: true,
+      flags: 0,
+      seq: 0,
+      timestampUs: 0,
+      tlvs: [{ type: msg[0], value }],
+    };
+  }
+
+  if (msg.length < HDR_LEN + CRC_LEN) return { error: "short" };
+  if (msg[1] !== VERSION) return { error: "version" };
+  const bodyLen = msg.readUInt16BE(6);
+  if (HDR_LEN + bodyLen + CRC_LEN !== msg.length) return { error: "length" };
+  const crcOff = HDR_LEN + bodyLen;
+  if (crc16(msg.subarray(0, crcOff)) !== msg.readUInt16BE(crcOff)) {
+    return { error: "crc" };
+  }
+
+  const tlvs = [];
+  for (let off = HDR_LEN; off < crcOff; ) {
+    const end = off + 2 + (off + 1 < crcOff ? msg[off + 1] : 0);
+    if (off + 2 > crcOff || end > crcOff) return { error: "tlv" };
+    tlvs.push({ type: msg[off], value: msg.subarray(off + 2, end) });
+    off = end;
+  }
+  return {
+    legacy: false,
+    flags: msg[2],
+    seq: msg.readUInt16BE(4),
+    timestampUs: msg.readUInt32BE(8),
+    tlvs,
+  };
+};
+
+// 按路由表分发：routes = { [type]: { minLen, handler(value, frame) } }
+// 未知类型和长度不足的 TLV 跳过，返回已处理个数
+const dispatch = (frame, routes) => {
+  let handled = 0;
+  for (const tlv of frame.tlvs) {
+    const route = routes[tlv.type];
+    if (!route || tlv.value.length < route.minLen) continue;
+    route.handler(tlv.value, frame);
+    handled++;
+  }
+  return handled;
+};
+
+// 空样本：关键帧首个样本为全量，以此为基准解码
+const emptySample = () => ({
+  mode: 0,
+  distMm: 0,
+  irBits: 0,
+  adc: [0, 0, 0],
+  duty: [0, 0],
+  errorMilli: 0,
+});
+
+// 解码 TELEM_SAMPLE：在 ref 上应用增量，返回 { dtMs, sample }，越界返回 null
+const decodeSample = (value, ref) => {
+  if (value.length < 3) return null;
+  const mask = value.readUInt16BE(1);
+  const s = { ...ref, adc: [...ref.adc], duty: [...ref.duty] };
+  let off = 3;
+  try {
+    if (mask & TELEM_F.MODE) s.mode = value.readUInt8(off++);
+    if (mask & TELEM_F.DIST) {
+      s.distMm = value.readUInt16BE(off);
+      off += 2;
+    }
+    if (mask & TELEM_F.IR) s.irBits = value.readUInt8(off++);
+    for (let i = 0; i < 3; i++) {
+      if (mask & (TELEM_F.ADC_L << i)) {
+        s.adc[i] = value.readUInt16BE(off);
+        off += 2;
+      }
+    }
+    if (mask & TELEM_F.DUTY_L) s.duty[0] = value.readInt8(off++);
+    if (mask & TELEM_F.DUTY_R) s.duty[1] = value.readInt8(off++);
+    if (mask & TELEM_F.ERROR) {
+      s.errorMilli = value.readInt16BE(off);
+      off += 2;
+    }
+  } catch (e) {
+    return null; // RangeError：字段超出 TLV 长度
+  }
+  return { dtMs: value[0], sample: s };
+};
+
+module.exports = {
+  TLV,
+  TELEM_F,
+  FLAG_UPLINK,
+  crc16,
+  encode,
+  parse,
+  dispatch,
+  emptySample,
+  decodeSample,
+};
@@ -1,5 +1,13 @@
 const WebSocket = require("ws");
 const dgram = require("dgram");
+const {
+  TLV,
+  encode,
+  parse,
+  dispatch,
+  emptySample,
+  decodeSample,
+} = require("./robot_proto");
 
 // --- 严格的配置常量 ---
 const CONFIG = {
@@ -8,11 +16,17 @@ const CONFIG = {
   UDP_RECV_PORT: 8889, // 代理监听端口 (对应小车广播目标端口)
   HEARTBEAT_INTERVAL: 1000, // 心跳发送间隔 1s
   TIMEOUT_THRESHOLD: 5000, // 超时判定阈值 5s (增加容错)
+  PROTO_V2: true, // 下行使用 v2 帧 (false 时发送旧版 5 字节帧)
+  TELEMETRY_HZ: 20, // 请求的状态流采样率 (1~100Hz，0 关闭，仅 v2)
+  ACK_INTERVAL: 100, // 状态流确认最小间隔 (ms)
+  TELEM_SNAPSHOTS: 64, // 每台设备保留的已解码快照数（增量基准）
 };
 
 // --- 全局状态 ---
 const devices = new Map(); // Key: IP, Value: { lastSeen, mac, name, status }
 const activeIntervals = new Map(); // 存储快速回复定时器
+const controlSeq = new Map(); // Key: IP, Value: 控制包 8 位帧序号 (1~255)
+const frameSeq = new Map(); // Key: IP, Value: v2 帧序号 (16 位循环)
 const udpSocket = dgram.createSocket("udp4");
 const wss = new WebSocket.Server({ port: CONFIG.WS_PORT });
 
@@ -44,6 +58,102 @@ const buildPacket = (type, cmd, m1 = 0, m2 = 0, extra = 0) => {
   return buf;
 };
 
+// 按设备分配帧序号组 v2 帧
+const buildFrame = (ip, tlvs) => {
+  const seq = frameSeq.get(ip) || 0;
+  frameSeq.set(ip, (seq + 1) & 0xffff);
+  return encode(tlvs, { seq });
+};
+
+// 构建下行命令：value 为 TLV 内容，旧版帧按 [cmd, m1, m2] 填充
+const buildCommand = (ip, type, value = []) => {
+  if (!CONFIG.PROTO_V2) return buildPacket(type, ...value);
+  return buildFrame(ip, [{ type, value }]);
+};
+
+// 心跳：v2 下同帧携带状态流请求（小车重连后状态流需要重新请求）
+const buildHeartbeat = (ip) => {
+  if (!CONFIG.PROTO_V2 || !CONFIG.TELEMETRY_HZ) {
+    return buildCommand(ip, TLV.HEARTBEAT);
+  }
+  return buildFrame(ip, [
+    { type: TLV.HEARTBEAT },
+    { type: TLV.STREAM, value: [CONFIG.TELEMETRY_HZ] },
+  ]);
+};
+
+// 上行 TLV 路由：同一帧内的多个 TLV 合并到一个状态对象
+// stream 为本帧状态流解码上下文 { ref, samples, snaps }，ref 为 null 表示
+// 增量基准已丢失（本帧无法解码，等待下一个关键帧）
+const uplinkRoutes = (status, stream) => ({
+  [TLV.STATUS]: {
+    minLen: 4,
+    handler: (v) => {
+      status.mode = v[0];
+      status.distance = v.readUInt16BE(1) / 10; // mm -> cm
+      status.ir = [v[3] & 1, (v[3] >> 1) & 1, (v[3] >> 2) & 1];
+    },
+  },
+  [TLV.LINE_ADC]: {
+    minLen: 6,
+    handler: (v) => {
+      status.adc = [v.readUInt16BE(0), v.readUInt16BE(2), v.readUInt16BE(4)];
+    },
+  },
+  [TLV.MOTOR]: {
+    minLen: 2,
+    handler: (v) => {
+      status.duty = [v.readInt8(0), v.readInt8(1)];
+    },
+  },
+  [TLV.TELEM_BASE]: {
+    minLen: 2,
+    handler: (v) => {
+      stream.ref = stream.snaps.get(v.readUInt16BE(0)) || null;
+    },
+  },
+  [TLV.TELEM_SAMPLE]: {
+    minLen: 3,
+    handler: (v) => {
+      if (!stream.ref) return;
+      const decoded = decodeSample(v, stream.ref);
+      stream.ref = decoded ? decoded.sample : null;
+      if (decoded) stream.samples++;
+    },
+  },
+});
+
+// 状态流样本转为前端状态字段
+const applySample = (status, s) => {
+  status.mode = s.mode;
+  status.distance = s.distMm / 10; // mm -> cm
+  status.ir = [s.irBits & 1, (s.irBits >> 1) & 1, (s.irBits >> 2) & 1];
+  status.adc = [...s.adc];
+  status.duty = [...s.duty];
+  status.error = s.errorMilli / 1000;
+};
+
+// 保存本帧解码结果作为后续增量基准，并按 ACK_INTERVAL 节流确认
+const ackTelemetry = (dev, seq, sample, now) => {
+  const { snaps } = dev.telem;
+  snaps.delete(seq);
+  snaps.set(seq, sample);
+  if (snaps.size > CONFIG.TELEM_SNAPSHOTS) {
+    snaps.delete(snaps.keys().next().value); // Map 按插入顺序，删除最旧
+  }
+  if (now - dev.telem.lastAck < CONFIG.ACK_INTERVAL) return;
+  dev.telem.lastAck = now;
+  const value = [(seq >> 8) & 0xff, seq & 0xff];
+  sendToCar(buildCommand(dev.ip, TLV.ACK, value), dev.ip);
+};
+
+// 下一个控制包帧序号（跳过 0，0 表示不带序号）
+const nextControlSeq = (ip) => {
+  const seq = ((controlSeq.get(ip) || 0) % 255) + 1;
+  controlSeq.set(ip, seq);
+  return seq;
+};
+
 // --- UDP 核心逻辑 ---
 
 udpSocket.on("error", (err) => {
@@ -84,7 +194,14 @@ udpSocket.on("message", (msg, rinfo) => {
 
     if (!dev || now - dev.lastSeen > CONFIG.TIMEOUT_THRESHOLD) {
       console.log(`[发现] 新设备/重连 IP:${ip} MAC:${mac} Name:${name}`);
-      dev = { ip, mac, name, lastSeen: now, status: null };
+      dev = {
+        ip,
+        mac,
+        name,
+        lastSeen: now,
+        status: null,
+        telem: { snaps: new Map(), lastAck: 0 },
+      };
       devices.set(ip, dev);
       isNew = true;
 
@@ -105,7 +222,7 @@ udpSocket.on("message", (msg, rinfo) => {
 
     let count = 0;
     const fastReply = setInterval(() => {
-      sendToCar(buildPacket(0xfe, 0), ip);
+      sendToCar(buildHeartbeat(ip), ip);
       if (++count >= 3) {
         clearInterval(fastReply);
         activeIntervals.delete(ip);
@@ -116,18 +233,26 @@ udpSocket.on("message", (msg, rinfo) => {
     return;
   }
 
-  // 2. 处理普通业务包 (心跳0xFE 或 状态0x02)
+  // 2. 处理普通业务包 (v2 帧或旧版心跳0xFE / 状态0x02)
   if (dev) {
     dev.lastSeen = now; // 刷新保活时间
 
-    if (type === 0x02 && msg.length >= 5) {
-      // 解析状态包
-      const irRaw = msg[4];
-      const status = {
-        mode: msg[1],
-        distance: msg[2] / 10,
-        ir: [irRaw & 1, (irRaw >> 1) & 1, (irRaw >> 2) & 1],
-      };
+    // 飞行记录包由 tools/flight_decode.py 离线解析
+    if (type === TLV.FLIGHT) return;
+
+    const frame = parse(msg);
+    if (frame.error) {
+      console.warn(`[协议] 无效帧 ${ip}: ${frame.error}`);
+      return;
+    }
+
+    const status = { ...dev.status };
+    const stream = { ref: emptySample(), samples: 0, snaps: dev.telem.snaps };
+    if (dispatch(frame, uplinkRoutes(status, stream)) > 0) {
+      if (stream.samples > 0 && stream.ref) {
+        applySample(status, stream.ref);
+        ackTelemetry(dev, frame.seq, stream.ref, now);
+      }
       dev.status = status;
 
       // 推送给前端
@@ -160,7 +285,7 @@ setInterval(() => {
 
     // 2. 主动发送心跳 (维持小车端的连接状态)
     // 即使没有控制命令，也要每2秒发一次 0xFE
-    sendToCar(buildPacket(0xfe, 0), ip);
+    sendToCar(buildHeartbeat(ip), ip);
   });
 }, CONFIG.HEARTBEAT_INTERVAL);
 
@@ -191,18 +316,31 @@ wss.on("connection", (ws) => {
 
       switch (data.type) {
         case "control": // 摇杆控制
-          sendToCar(buildPacket(0x01, 0, data.motor1, data.motor2), ip);
+          sendToCar(
+            buildCommand(ip, TLV.DRIVE, [
+              nextControlSeq(ip),
+              data.motor1,
+              data.motor2,
+            ]),
+            ip,
+          );
           break;
         case "modeChange": // 模式切换
           const modeMap = { standby: 0, tracking: 1, avoid: 2, remote: 3 };
-          sendToCar(buildPacket(0x03, modeMap[data.mode] || 0), ip);
+          sendToCar(
+            buildCommand(ip, TLV.MODE, [modeMap[data.mode] || 0]),
+            ip,
+          );
           break;
         case "setPid": // PID参数
           const val =
             data.paramType <= 3 ? Math.round(data.value * 100) : data.value;
           const high = (val >> 8) & 0xff;
           const low = val & 0xff;
-          sendToCar(buildPacket(0x04, data.paramType, high, low), ip);
+          sendToCar(
+            buildCommand(ip, TLV.PID, [data.paramType, high, low]),
+            ip,
+          );
           break;
       }
     } catch (e) {
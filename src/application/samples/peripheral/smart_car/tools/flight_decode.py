@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""飞行记录仪上位机：开启小车记录、接收 UDP 批量记录并解码为 CSV
+
+用法:
+    python3 flight_decode.py --car 192.168.4.1 --out run.csv [--seconds 30]
+    python3 flight_decode.py --raw run.bin --out run.csv     # 解码已保存的原始包
+
+说明:
+    本脚本向小车发送 0x20 开始命令后即成为小车的连接对象（会接管代理的连接），
+    期间每秒发送心跳保活；结束时发送停止命令。记录格式见
+    apps/robot_demo/services/flight_recorder.h
+"""
+
+import argparse
+import csv
+import socket
+import struct
+import sys
+import time
+
+CAR_PORT = 8888
+PKT_TYPE = 0x20
+PKT_VERSION = 1
+
+HEADER = struct.Struct("<BBHI")  # type, version, count, dropped
+RECORD = struct.Struct("<IH3HhhhhbbHBB")  # 26 字节，与 FlightRecord 一致
+
+COLUMNS = ["t_us", "seq", "adc_left", "adc_middle", "adc_right", "error",
+           "p", "i", "d", "duty_left", "duty_right", "dist_cm", "mode"]
+
+
+def decode_packet(data):
+    """解码一个导出包，返回 (dropped, [行...])；非记录包返回 None"""
+    if len(data) < HEADER.size:
+        return None
+    ptype, version, count, dropped = HEADER.unpack_from(data, 0)
+    if ptype != PKT_TYPE or version != PKT_VERSION:
+        return None
+    if len(data) < HEADER.size + count * RECORD.size:
+        print("[警告] 包长度不足，已丢弃", file=sys.stderr)
+        return None
+
+    rows = []
+    for k in range(count):
+        (t_us, seq, adc_l, adc_m, adc_r, err, p, i, d, duty_l, duty_r, dist_mm,
+         mode, _) = RECORD.unpack_from(data, HEADER.size + k * RECORD.size)
+        rows.append([t_us, seq, adc_l, adc_m, adc_r, err / 1000.0, p / 100.0,
+                     i / 100.0, d / 100.0, duty_l, duty_r, dist_mm / 10.0,
+                     mode])
+    return dropped, rows
+
+
+class GapCounter:
+    """根据 16 位序号统计丢失的记录"""
+
+    def __init__(self):
+        self.last = None
+        self.lost = 0
+
+    def feed(self, seq):
+        if self.last is not None:
+            self.lost += (seq - self.last - 1) & 0xFFFF
+        self.last = seq
+
+
+def write_rows(writer, gaps, rows):
+    for row in rows:
+        gaps.feed(row[1])
+        writer.writerow(row)
+
+
+def capture(args, writer, gaps):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("", 0))
+    sock.settimeout(0.2)
+    car = (args.car, CAR_PORT)
+    raw = open(args.save_raw, "wb") if args.save_raw else None
+
+    sock.sendto(bytes([PKT_TYPE, 1, 0, 0, 0]), car)
+    print(f"已向 {args.car} 发送开始命令，Ctrl+C 结束")
+
+    total, dropped = 0, 0
+    start = last_hb = time.time()
+    try:
+        while args.seconds <= 0 or time.time() - start < args.seconds:
+            if time.time() - last_hb >= 1.0:
+                sock.sendto(bytes([0xFE, 0, 0, 0, 0]), car)
+                last_hb = time.time()
+            try:
+                data, _ = sock.recvfrom(2048)
+            except socket.timeout:
+                continue
+            result = decode_packet(data)
+            if result is None:
+                continue
+            if raw:
+                raw.write(struct.pack("<H", len(data)) + data)
+            dropped, rows = result
+            write_rows(writer, gaps, rows)
+            total += len(rows)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        sock.sendto(bytes([PKT_TYPE, 0, 0, 0, 0]), car)
+        sock.close()
+        if raw:
+            raw.close()
+    print(f"共 {total} 条记录，小车端丢弃 {dropped} 条，序号缺口 {gaps.lost} 条")
+
+
+def decode_raw(args, writer, gaps):
+    total = 0
+    with open(args.raw, "rb") as f:
+        while True:
+            head = f.read(2)
+            if len(head) < 2:
+                break
+            (length,) = struct.unpack("<H", head)
+            result = decode_packet(f.read(length))
+            if result is None:
+                continue
+            write_rows(writer, gaps, result[1])
+            total += len(result[1])
+    print(f"共 {total} 条记录，序号缺口 {gaps.lost} 条")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="飞行记录仪数据采集/解码")
+    src = parser.add_mutually_exclusive_group(required=True)
+    src.add_argument("--car", help="小车 IP，实时采集")
+    src.add_argument("--raw", help="解码 --save-raw 保存的原始包文件")
+    parser.add_argument("--out", required=True, help="输出 CSV 文件")
+    parser.add_argument("--seconds", type=float, default=0,
+                        help="采集时长，0 表示直到 Ctrl+C")
+    parser.add_argument("--save-raw", help="同时保存原始包，便于重新解码")
+    args = parser.parse_args()
+
+    gaps = GapCounter()
+    with open(args.out, "w", newline="", encoding="utf-8") as f:
+        writer = csv.writer(f)
+        writer.writerow(COLUMNS)
+        if args.car:
+            capture(args, writer, gaps)
+        else:
+            decode_raw(args, writer, gaps)
+
+
+if __name__ == "__main__":
+    main()
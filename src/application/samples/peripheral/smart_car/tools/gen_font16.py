@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""16x16 点阵字库生成器：维护 drivers/ssd1306/FontDotMatrix16.c
+
+用法:
+    python3 gen_font16.py                                   # 按码点重新排序生成
+    python3 gen_font16.py --hex unifont.hex --words words.txt
+    python3 gen_font16.py --hex unifont.hex --text "扫描舵机"
+
+说明:
+    读取现有 FontDotMatrix16.c 中的全部字形，按需从 GNU Unifont 的 .hex
+    文件（每行 "码点:点阵"，16x16 字形为 64 个十六进制字符，行扫描高位在前）
+    补充词表 / 文本中出现但字库缺少的字符，然后按 Unicode 码点
+    升序重新生成 FontDotMatrix16.c，供 ssd1306_DrawString16 二分查找。
+
+    字库格式：列行扫描、低位在前，前 16 字节为上半页 (行 0~7) 各列，
+    后 16 字节为下半页 (行 8~15) 各列，与 SSD1306 显存页格式一致。
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_FONT_C = os.path.join(SCRIPT_DIR, "..", "drivers", "ssd1306",
+                              "FontDotMatrix16.c")
+GLYPH_BYTES = 32
+BYTES_PER_LINE = 11
+
+
+def parse_c_string(lit):
+    """解析 C 字符串字面量内容（仅处理字库中出现的转义）"""
+    return re.sub(r'\\(.)', r'\1', lit)
+
+
+def load_font_c(path):
+    """读取现有字库，返回 {码点: 32 字节}"""
+    with open(path, encoding="utf-8-sig") as f:
+        text = f.read()
+
+    m = re.search(r"g_font_dot_matrix_16\[\d*\]\[%d\]\s*=" % GLYPH_BYTES, text)
+    if not m:
+        sys.exit("[错误] 未找到字形数组")
+    glyph_text = re.sub(r"/\*.*?\*/", "", text[m.end():], flags=re.S)
+    blocks = re.findall(r"\{([^{}]*)\}", glyph_text)
+    glyphs = [bytes(int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", b))
+              for b in blocks]
+
+    m = re.search(r"g_font_dot_matrix_16_code\[[^\]]*\]\s*=\s*\{([^}]*)\}",
+                  text)
+    if m:
+        codes = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", m.group(1))]
+    else:
+        # 旧格式：UTF-8 字符串索引表
+        m = re.search(r"g_font_dot_matrix_16_index\[[^\]]*\]\s*=\s*\{(.*?)\};",
+                      text, re.S)
+        if not m:
+            sys.exit("[错误] 未找到字库索引表")
+        chars = [parse_c_string(s)
+                 for s in re.findall(r'"((?:[^"\\]|\\.)*)"', m.group(1))]
+        codes = [ord(c) for c in chars]
+
+    if len(codes) != len(glyphs):
+        sys.exit("[错误] 索引数量 %d 与字形数量 %d 不一致" %
+                 (len(codes), len(glyphs)))
+    font = {}
+    for code, glyph in zip(codes, glyphs):
+        if len(glyph) != GLYPH_BYTES:
+            sys.exit("[错误] U+%04X 字形长度 %d" % (code, len(glyph)))
+        font[code] = glyph
+    return font
+
+
+def load_unifont_hex(path):
+    """读取 Unifont .hex，仅保留 16x16 字形，返回 {码点: 行扫描 32 字节}"""
+    font = {}
+    with open(path, encoding="ascii") as f:
+        for line in f:
+            line = line.strip()
+            if not line or ":" not in line:
+                continue
+            code, bits = line.split(":", 1)
+            if len(bits) == 64:
+                font[int(code, 16)] = bytes.fromhex(bits)
+    return font
+
+
+def rows_to_pages(rows):
+    """行扫描（每行 2 字节，高位在左）转为列行扫描（低位在上）"""
+    out = bytearray(GLYPH_BYTES)
+    for y in range(16):
+        row = (rows[y * 2] << 8) | rows[y * 2 + 1]
+        for x in range(16):
+            if row & (0x8000 >> x):
+                out[(y // 8) * 16 + x] |= 1 << (y % 8)
+    return bytes(out)
+
+
+def collect_chars(args):
+    """汇总需要的字符（ASCII 由 7x10 字体绘制，不需要补充）"""
+    wanted = set()
+    for path in args.words or []:
+        with open(path, encoding="utf-8") as f:
+            wanted.update(f.read())
+    if args.text:
+        wanted.update(args.text)
+    return {ord(c) for c in wanted if ord(c) > 0x7F and not c.isspace()}
+
+
+def char_label(code):
+    c = chr(code)
+    return "\\\\" if c == "\\" else c
+
+
+def write_font_c(path, font):
+    codes = sorted(font)
+    if codes and codes[-1] > 0xFFFF:
+        sys.exit("[错误] 仅支持基本多文种平面 (U+0000~U+FFFF) 的字符")
+
+    out = []
+    out.append("/* 由 tools/gen_font16.py 生成，请勿手工编辑 */\n")
+    out.append("/* 扫描方式：列行扫描  取模走向：低位在前（与 SSD1306 页格式一致）\n")
+    out.append(" * 前 16 字节为上半页 (行 0~7)，后 16 字节为下半页 (行 8~15)\n")
+    out.append(" * 码点表按升序排列，查找时使用二分查找 */\n\n")
+    out.append('#include "FontDotMatrix16.h"\n\n')
+    out.append("const uint16_t g_font_dot_matrix_16_count = %d;\n\n" %
+               len(codes))
+
+    out.append("const uint16_t g_font_dot_matrix_16_code[%d] = {\n" %
+               len(codes))
+    for i in range(0, len(codes), 8):
+        line = ", ".join("0x%04X" % c for c in codes[i:i + 8])
+        out.append("    %s,\n" % line)
+    out.append("};\n\n")
+
+    out.append("const uint8_t g_font_dot_matrix_16[%d][%d] = {\n" %
+               (len(codes), GLYPH_BYTES))
+    for i, code in enumerate(codes):
+        out.append('    /* "%s" U+%04X, %d */\n' % (char_label(code), code, i))
+        out.append("    {\n")
+        glyph = font[code]
+        for j in range(0, GLYPH_BYTES, BYTES_PER_LINE):
+            line = ", ".join("0x%02X" % b for b in glyph[j:j + BYTES_PER_LINE])
+            out.append("        %s,\n" % line)
+        out.append("    },\n")
+    out.append("};\n")
+
+    with open(path, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("".join(out))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成 16x16 点阵字库")
+    parser.add_argument("--font", default=DEFAULT_FONT_C,
+                        help="FontDotMatrix16.c 路径（读取并覆盖写回）")
+    parser.add_argument("--hex", help="GNU Unifont .hex 点阵源文件")
+    parser.add_argument("--words", action="append",
+                        help="词表文件（UTF-8），可重复指定")
+    parser.add_argument("--text", help="直接指定需要的字符")
+    args = parser.parse_args()
+
+    font = load_font_c(args.font)
+    missing = sorted(collect_chars(args) - set(font))
+
+    if missing:
+        if not args.hex:
+            sys.exit("[错误] 缺少 %d 个字符，需要 --hex 提供点阵源: %s" %
+                     (len(missing), "".join(chr(c) for c in missing)))
+        source = load_unifont_hex(args.hex)
+        for code in missing:
+            if code not in source:
+                print("[警告] 点阵源中没有 U+%04X (%s)，已跳过" %
+                      (code, chr(code)), file=sys.stderr)
+                continue
+            font[code] = rows_to_pages(source[code])
+            print("[新增] U+%04X %s" % (code, chr(code)))
+
+    write_font_c(args.font, font)
+    print("[完成] %d 个字形 -> %s" % (len(font), os.path.normpath(args.font)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+/**
+ * @file        odometry_test.c
+ * @brief       里程计主机测试：用合成的脉冲序列验证位姿积分和轮速估计
+ * @details     在 smart_car 目录下编译运行：
+ *              cc -std=c99 -Wall -O2 -Iapps/robot_demo/core
+ *                 tools/odometry_test.c apps/robot_demo/core/odometry.c
+ *                 -lm -o /tmp/odometry_test && /tmp/odometry_test
+ *              全部通过时返回 0，否则打印失败项并返回 1
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "odometry.h"
+
+#define TEST_PI 3.14159265f
+#define TEST_TRACK_MM 130.0f
+// 取 100 个脉冲恰好原地转 90 度，便于构造整数脉冲序列
+#define TEST_MM_PER_PULSE (TEST_TRACK_MM * 0.5f * TEST_PI / 200.0f)
+#define TEST_TOL_MM 0.5f
+#define TEST_TOL_RAD 0.002f
+#define TEST_STEP 5  // 每次输入的脉冲增量，模拟控制周期内的计数变化
+
+static int g_failures = 0;
+
+static void check(const char* name, const char* what, float got, float want,
+                  float tol) {
+  if (fabsf(got - want) <= tol) return;
+  printf("FAIL %s: %s = %.4f, 期望 %.4f (容差 %.4f)\n", name, what, got, want,
+         tol);
+  g_failures++;
+}
+
+static void check_pose(const char* name, const Odometry* odo, float x, float y,
+                       float heading, float distance) {
+  check(name, "x_mm", odo->pose.x_mm, x, TEST_TOL_MM);
+  check(name, "y_mm", odo->pose.y_mm, y, TEST_TOL_MM);
+  check(name, "heading_rad", odo->pose.heading_rad, heading, TEST_TOL_RAD);
+  check(name, "distance_mm", odo->pose.distance_mm, distance, TEST_TOL_MM);
+}
+
+/**
+ * @brief 从给定计数开始初始化里程计（首次输入只记录基准）
+ */
+static void start(Odometry* odo, uint32_t* cl, uint32_t* cr, uint32_t base) {
+  OdometryConfig cfg = {.mm_per_pulse = TEST_MM_PER_PULSE,
+                        .track_mm = TEST_TRACK_MM};
+  odometry_init(odo, &cfg);
+  *cl = base;
+  *cr = base;
+  odometry_update(odo, *cl, *cr, 1, 1);
+}
+
+/**
+ * @brief 按固定步长输入 n 步，每步左右轮各增加 sl / sr 个脉冲
+ */
+static void run(Odometry* odo, uint32_t* cl, uint32_t* cr, int n, uint32_t sl,
+                uint32_t sr, int dir_l, int dir_r) {
+  for (int i = 0; i < n; i++) {
+    *cl += sl;
+    *cr += sr;
+    odometry_update(odo, *cl, *cr, dir_l, dir_r);
+  }
+}
+
+static void test_straight(void) {
+  Odometry odo;
+  uint32_t cl, cr;
+  start(&odo, &cl, &cr, 0);
+  run(&odo, &cl, &cr, 200, TEST_STEP, TEST_STEP, 1, 1);  // 1000 个脉冲
+  float d = 1000.0f * TEST_MM_PER_PULSE;
+  check_pose("直行", &odo, d, 0.0f, 0.0f, d);
+}
+
+static void test_pivot(void) {
+  Odometry odo;
+  uint32_t cl, cr;
+
+  // 左轮后退、右轮前进：逆时针原地转 90 度，中心点不动
+  start(&odo, &cl, &cr, 0);
+  run(&odo, &cl, &cr, 20, TEST_STEP, TEST_STEP, -1, 1);
+  check_pose("原地左转 90 度", &odo, 0.0f, 0.0f, 0.5f * TEST_PI, 0.0f);
+  check("原地左转 90 度", "heading_total_rad", odo.pose.heading_total_rad,
+        0.5f * TEST_PI, TEST_TOL_RAD);
+
+  start(&odo, &cl, &cr, 0);
+  run(&odo, &cl, &cr, 20, TEST_STEP, TEST_STEP, 1, -1);
+  check_pose("原地右转 90 度", &odo, 0.0f, 0.0f, -0.5f * TEST_PI, 0.0f);
+  check("原地右转 90 度", "heading_total_rad", odo.pose.heading_total_rad,
+        -0.5f * TEST_PI, TEST_TOL_RAD);
+
+  // 连续左转 5 圈：航向归一化，累计转角不归一化
+  start(&odo, &cl, &cr, 0);
+  run(&odo, &cl, &cr, 400, TEST_STEP, TEST_STEP, -1, 1);
+  check("原地左转 5 圈", "heading_rad", odo.pose.heading_rad, 0.0f,
+        TEST_TOL_RAD * 5.0f);
+  check("原地左转 5 圈", "heading_total_rad", odo.pose.heading_total_rad,
+        10.0f * TEST_PI, TEST_TOL_RAD * 5.0f);
+}
+
+static void test_arc(void) {
+  Odometry odo;
+  uint32_t cl, cr;
+
+  // 右轮脉冲为左轮两倍：半径 1.5 * track 的逆时针圆弧，走四分之一圆
+  // 左轮 200、右轮 400 个脉冲时转角恰为 90 度
+  start(&odo, &cl, &cr, 0);
+  run(&odo, &cl, &cr, 40, TEST_STEP, 2 * TEST_STEP, 1, 1);
+  float r = 1.5f * TEST_TRACK_MM;
+  check_pose("圆弧", &odo, r, r, 0.5f * TEST_PI, 0.5f * TEST_PI * r);
+}
+
+static void test_direction_flip(void) {
+  Odometry odo;
+  uint32_t cl, cr;
+
+  // 前进 500 个脉冲后反向后退 500 个：回到原点，路程累加
+  start(&odo, &cl, &cr, 0);
+  run(&odo, &cl, &cr, 100, TEST_STEP, TEST_STEP, 1, 1);
+  run(&odo, &cl, &cr, 100, TEST_STEP, TEST_STEP, -1, -1);
+  float d = 500.0f * TEST_MM_PER_PULSE;
+  check_pose("换向", &odo, 0.0f, 0.0f, 0.0f, 2.0f * d);
+}
+
+static void test_counter_wrap(void) {
+  Odometry odo;
+  uint32_t cl, cr;
+
+  // 计数从回绕点前 256 开始，前进 1000 个脉冲跨过 0xFFFFFFFF
+  start(&odo, &cl, &cr, 0xFFFFFF00u);
+  run(&odo, &cl, &cr, 200, TEST_STEP, TEST_STEP, 1, 1);
+  float d = 1000.0f * TEST_MM_PER_PULSE;
+  check_pose("计数回绕", &odo, d, 0.0f, 0.0f, d);
+}
+
+static void test_wheel_speed(void) {
+  OdometryConfig cfg = {.mm_per_pulse = TEST_MM_PER_PULSE,
+                        .track_mm = TEST_TRACK_MM};
+  float v = TEST_MM_PER_PULSE * 100.0f;  // 脉冲间隔 10ms
+  uint64_t edge = 1000000;
+
+  check("轮速", "刚收到脉冲",
+        odometry_wheel_speed(&cfg, 10000, edge, edge + 2000), v, 0.01f);
+  check("轮速", "停转 20ms 后衰减",
+        odometry_wheel_speed(&cfg, 10000, edge, edge + 20000), 0.5f * v,
+        0.01f);
+  check("轮速", "超时",
+        odometry_wheel_speed(&cfg, 10000, edge,
+                             edge + ODOMETRY_SPEED_TIMEOUT_US + 1),
+        0.0f, 0.0f);
+  check("轮速", "间隔未知", odometry_wheel_speed(&cfg, 0, edge, edge), 0.0f,
+        0.0f);
+  check("轮速", "从未收到脉冲", odometry_wheel_speed(&cfg, 10000, 0, 2000),
+        0.0f, 0.0f);
+}
+
+int main(void) {
+  test_straight();
+  test_pivot();
+  test_arc();
+  test_direction_flip();
+  test_counter_wrap();
+  test_wheel_speed();
+
+  if (g_failures != 0) {
+    printf("odometry_test: %d 项失败\n", g_failures);
+    return 1;
+  }
+  printf("odometry_test: 全部通过\n");
+  return 0;
+}
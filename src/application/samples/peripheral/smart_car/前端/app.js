@@ -106,6 +106,8 @@ function sendPid(type) {
   else if (type === 3) val = parseFloat(document.getElementById("pidKd").value);
   else if (type === 4)
     val = parseInt(document.getElementById("pidSpeed").value);
+  else if (type === 5)
+    val = parseInt(document.getElementById("pidErrSrc").value);
 
   console.log(
     `[Frontend] Sending PID: type=${type}, val=${val}, IP=${deviceIP}`,